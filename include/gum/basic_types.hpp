@@ -19,9 +19,14 @@
 #define  GUM_BASIC_TYPES_HPP__
 
 #include <cinttypes>
+#include <cassert>
+#include <cstddef>
 #include <algorithm>
+#include <iterator>
+#include <memory>
 #include <istream>
 #include <functional>
+#include <type_traits>
 
 
 namespace gum {
@@ -29,6 +34,13 @@ namespace gum {
   struct Dynamic {};
   /* Succinct specialization tag. */
   struct Succinct {};
+  /* Compressed specialization tag. */
+  struct Compressed {};
+  /* Deferred data movement tag (e.g. for lazy `sort_nodes`). */
+  struct Lazy {};
+  /* Context length unit tags (e.g. for `extract_subgraph`). */
+  struct BasePairs {};
+  struct Steps {};
 
   /**
    *  @brief  Wrap signed integer type of width TWidth.
@@ -221,6 +233,271 @@ namespace gum {
       function_type m_f;
   };
 
+  /**
+   *  @brief  A vector of trivially copyable values with a small inline buffer.
+   *
+   *  Up to `TInline` values (or as many as fit into the space of a pointer if
+   *  it is more) are stored inline without any heap allocation. The values are
+   *  moved to a heap buffer once the size exceeds the inline capacity. With two
+   *  64-bit values inline, it takes the same space as a `std::vector`.
+   */
+  template< typename TValue, std::size_t TInline >
+  class SmallVector {
+  public:
+    /* === TYPEDEFS === */
+    using value_type = TValue;
+    using size_type = uint32_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = value_type const&;
+    using pointer = value_type*;
+    using const_pointer = value_type const*;
+    using iterator = pointer;
+    using const_iterator = const_pointer;
+
+    static_assert( std::is_trivially_copyable< value_type >::value, "values should be trivially copyable" );
+
+    /* === CONSTANTS === */
+    constexpr static size_type INLINE_CAPACITY =
+        std::max( TInline, sizeof( pointer ) / sizeof( value_type ) );
+
+    /* === LIFECYCLE === */
+    SmallVector( ) noexcept                                    /* constructor      */
+      : m_data{}, m_size( 0 ), m_capacity( INLINE_CAPACITY )
+    { }
+
+    SmallVector( SmallVector const& other )                    /* copy constructor */
+      : SmallVector( )
+    {
+      this->assign( other.begin(), other.end() );
+    }
+
+    SmallVector( SmallVector&& other ) noexcept                /* move constructor */
+      : SmallVector( )
+    {
+      this->swap( other );
+    }
+
+    ~SmallVector( ) noexcept                                   /* destructor       */
+    {
+      this->release();
+    }
+
+    /* === OPERATORS === */
+    SmallVector&
+    operator=( SmallVector const& other )                      /* copy assignment operator */
+    {
+      if ( this != &other ) this->assign( other.begin(), other.end() );
+      return *this;
+    }
+
+    SmallVector&
+    operator=( SmallVector&& other ) noexcept                  /* move assignment operator */
+    {
+      if ( this != &other ) {
+        this->release();
+        this->m_size = 0;
+        this->swap( other );
+      }
+      return *this;
+    }
+
+    inline reference
+    operator[]( size_type i )
+    {
+      return this->data()[ i ];
+    }
+
+    inline const_reference
+    operator[]( size_type i ) const
+    {
+      return this->data()[ i ];
+    }
+
+    inline bool
+    operator==( SmallVector const& other ) const
+    {
+      return this->size() == other.size() &&
+          std::equal( this->begin(), this->end(), other.begin() );
+    }
+
+    inline bool
+    operator!=( SmallVector const& other ) const
+    {
+      return !( *this == other );
+    }
+
+    /* === METHODS === */
+    inline pointer
+    data( ) noexcept
+    {
+      return this->is_inline() ? this->m_data.buffer : this->m_data.heap;
+    }
+
+    inline const_pointer
+    data( ) const noexcept
+    {
+      return this->is_inline() ? this->m_data.buffer : this->m_data.heap;
+    }
+
+    inline size_type
+    size( ) const noexcept
+    {
+      return this->m_size;
+    }
+
+    inline size_type
+    capacity( ) const noexcept
+    {
+      return this->m_capacity;
+    }
+
+    inline bool
+    empty( ) const noexcept
+    {
+      return this->m_size == 0;
+    }
+
+    inline bool
+    is_inline( ) const noexcept
+    {
+      return this->m_capacity == INLINE_CAPACITY;
+    }
+
+    inline iterator begin( ) noexcept { return this->data(); }
+    inline iterator end( ) noexcept { return this->data() + this->m_size; }
+    inline const_iterator begin( ) const noexcept { return this->data(); }
+    inline const_iterator end( ) const noexcept { return this->data() + this->m_size; }
+    inline const_iterator cbegin( ) const noexcept { return this->begin(); }
+    inline const_iterator cend( ) const noexcept { return this->end(); }
+
+    inline reference
+    front( )
+    {
+      return *this->begin();
+    }
+
+    inline const_reference
+    front( ) const
+    {
+      return *this->begin();
+    }
+
+    inline reference
+    back( )
+    {
+      return *( this->end() - 1 );
+    }
+
+    inline const_reference
+    back( ) const
+    {
+      return *( this->end() - 1 );
+    }
+
+    inline void
+    reserve( size_type size )
+    {
+      if ( size > this->m_capacity ) this->reallocate( size );
+    }
+
+    inline void
+    push_back( value_type value )
+    {
+      if ( this->m_size == this->m_capacity ) this->reallocate( 2 * this->m_capacity );
+      this->data()[ this->m_size++ ] = value;
+    }
+
+    inline void
+    pop_back( )
+    {
+      assert( !this->empty() );
+      --this->m_size;
+    }
+
+    /**
+     *  @brief  Erase the value at `pos` keeping the order of the others.
+     */
+    inline iterator
+    erase( const_iterator pos )
+    {
+      iterator itr = this->begin() + ( pos - this->cbegin() );
+      std::copy( itr + 1, this->end(), itr );
+      --this->m_size;
+      return itr;
+    }
+
+    template< typename TIter >
+    inline void
+    assign( TIter first, TIter last )
+    {
+      this->clear();
+      this->reserve( std::distance( first, last ) );
+      this->m_size = std::copy( first, last, this->data() ) - this->data();
+    }
+
+    inline void
+    clear( ) noexcept
+    {
+      this->m_size = 0;
+    }
+
+    /**
+     *  @brief  Move the values back inline if they fit; otherwise, release the
+     *  unused capacity.
+     */
+    inline void
+    shrink_to_fit( )
+    {
+      if ( !this->is_inline() && this->m_size < this->m_capacity ) this->reallocate( this->m_size );
+    }
+
+    inline void
+    swap( SmallVector& other ) noexcept
+    {
+      std::swap( this->m_data, other.m_data );
+      std::swap( this->m_size, other.m_size );
+      std::swap( this->m_capacity, other.m_capacity );
+    }
+
+  private:
+    /* === DATA MEMBERS === */
+    union {
+      value_type buffer[ INLINE_CAPACITY ];
+      pointer heap;
+    } m_data;
+    size_type m_size;
+    size_type m_capacity;
+
+    /* === METHODS === */
+    inline void
+    reallocate( size_type new_capacity )
+    {
+      assert( this->m_size <= new_capacity );
+      if ( new_capacity <= INLINE_CAPACITY ) {
+        if ( this->is_inline() ) return;
+        pointer heap = this->m_data.heap;
+        std::copy( heap, heap + this->m_size, this->m_data.buffer );
+        std::allocator< value_type >().deallocate( heap, this->m_capacity );
+        this->m_capacity = INLINE_CAPACITY;
+        return;
+      }
+      pointer heap = std::allocator< value_type >().allocate( new_capacity );
+      std::copy( this->begin(), this->end(), heap );
+      this->release();
+      this->m_data.heap = heap;
+      this->m_capacity = new_capacity;
+    }
+
+    inline void
+    release( ) noexcept
+    {
+      if ( this->is_inline() ) return;
+      std::allocator< value_type >().deallocate( this->m_data.heap, this->m_capacity );
+      this->m_capacity = INLINE_CAPACITY;
+    }
+  };  /* --- end of template class SmallVector --- */
+
   template< typename TReturn >
   class ExternalLoader
     : public CallbackWrapper< TReturn, std::istream& > {
@@ -23,6 +23,7 @@
 #include <iterator>
 #include <numeric>
 #include <vector>
+#include <utility>
 #include <cassert>
 
 #include "basic_types.hpp"
@@ -283,6 +284,27 @@ namespace gum {
       }
     }
 
+    /**
+     *  @brief  Permute a container out of place in parallel.
+     *
+     *  It has the same semantics as `permute`; i.e. the element at `perm[i]`
+     *  is moved to `i`. In contrast, it needs space for another copy of the
+     *  container, but all elements are moved independently in parallel.
+     */
+    template< typename TPermContainer, typename TContainer >
+    inline void
+    permute_parallel( TPermContainer const& perm, TContainer& container )
+    {
+      assert( container.size() == perm.size() );
+
+      TContainer applied( container.size() );
+      #pragma omp parallel for schedule( static )
+      for ( std::size_t i = 0; i < applied.size(); ++i ) {
+        applied[ i ] = std::move( container[ perm[ i ] ] );
+      }
+      container = std::move( applied );
+    }
+
     template< typename TPermContainer, typename TFirst, typename ...TContainers >
     inline void
     permute( TPermContainer const& perm, TFirst& first, TContainers&&... rest )
@@ -423,7 +423,7 @@ namespace gum {
         if ( this->empty() ) return;
         this->reserve( this->size() + offset );
         std::copy_backward( this->ids.begin(), this->ids.begin() + this->size(),
-                            this->ids.begin() + this->size() + offset - 1 );
+                            this->ids.begin() + this->size() + offset );
         std::fill( this->ids.begin(), this->ids.begin() + offset, 0 );
       }
 
@@ -20,6 +20,10 @@
 #define  GUM_GFA_UTILS_HPP__
 
 #include <string>
+#include <vector>
+#include <iterator>
+#include <utility>
+#include <unordered_map>
 #include <istream>
 
 #include <gfakluge.hpp>
@@ -225,6 +229,30 @@ namespace gum {
     inline void
     add_edge( TGraph& graph, TGFAKEdge const& elem, GFAFormat, TCoordinate&& coord={},
               bool force=false )
+    {
+      auto edge = make_edge( graph, elem, GFAFormat{}, coord, force );
+      graph.add_edge( edge.first, edge.second );
+    }
+
+    /**
+     *  @brief  Make the link and edge property of an external edge (GFA overload).
+     *
+     *  @param  graph Graph of any native type with Dynamic spec tag
+     *  @param  elem External edge
+     *  @param  tag Format specifier tag
+     *  @param  coord Coorindate system converting the given node ids to graph local ids
+     *  @param  force Force node creation if any adjacent node does not exist in the graph
+     *  @return The pair of the link and the edge property to be added to the graph.
+     *
+     *  The adjacent nodes are created (if forced) but the edge itself is not added.
+     */
+    template< typename TGraph,
+              typename TGFAKEdge,
+              typename TCoordinate=GFAFormat::DefaultCoord< TGraph >,
+              typename=std::enable_if_t< std::is_same< typename TGraph::spec_type, Dynamic >::value > >
+    inline std::pair< typename TGraph::link_type, typename TGraph::edge_type >
+    make_edge( TGraph& graph, TGFAKEdge const& elem, GFAFormat, TCoordinate&& coord={},
+               bool force=false )
     {
       using graph_type = TGraph;
       using id_type = typename graph_type::id_type;
@@ -250,9 +278,9 @@ namespace gum {
            elem.source_end - elem.source_begin != elem.sink_end ) {
         throw std::runtime_error( "only simple dovetail overlap is supported" );
       }
-      graph.add_edge( link_type( src_id, elem.source_orientation_forward,
-                                 sink_id, !elem.sink_orientation_forward ),
-                      edge_type( elem.sink_end ) );
+      return { link_type( src_id, elem.source_orientation_forward,
+                          sink_id, !elem.sink_orientation_forward ),
+               edge_type( elem.sink_end ) };
     }
 
     /**
@@ -503,13 +531,50 @@ namespace gum {
     extend_graph( TGraph& graph, TGFAKGraph& other, GFAFormat, bool sort=false,
                   TCoordinate&& coord={} )
     {
-      for ( auto const& rec : other.get_name_to_seq() ) {
-        add( graph, rec.second, coord, true );
+      using graph_type = TGraph;
+      using id_type = typename graph_type::id_type;
+      using node_type = typename graph_type::node_type;
+      using link_type = typename graph_type::link_type;
+      using edge_type = typename graph_type::edge_type;
+
+      {
+        std::vector< std::pair< node_type, id_type > > nodes;
+        std::vector< std::string const* > names;
+        // Indices in `nodes` of the records seen so far in this batch
+        std::unordered_map< id_type, std::size_t > batch_ids;
+        std::unordered_map< std::string, std::size_t > batch_names;
+        nodes.reserve( other.get_name_to_seq().size() );
+        names.reserve( other.get_name_to_seq().size() );
+        for ( auto const& rec : other.get_name_to_seq() ) {
+          auto const& elem = rec.second;
+          id_type id = coord( elem.name );
+          if ( graph.has_node( id ) ) {  // forced update
+            graph.update_node( id, node_type( elem.sequence, elem.name ) );
+            continue;
+          }
+          std::size_t idx = nodes.size();
+          if ( id != 0 ) idx = batch_ids.emplace( id, idx ).first->second;
+          else idx = batch_names.emplace( elem.name, idx ).first->second;
+          if ( idx != nodes.size() ) {  // forced update of a repeated record
+            nodes[ idx ].first = node_type( elem.sequence, elem.name );
+            continue;
+          }
+          nodes.emplace_back( node_type( elem.sequence, elem.name ), id );
+          names.push_back( &elem.name );
+        }
+        auto name_itr = names.begin();
+        graph.add_nodes_bulk( std::make_move_iterator( nodes.begin() ),
+                              std::make_move_iterator( nodes.end() ),
+                              [&coord, &name_itr]( id_type id ) { coord( **name_itr++, id ); } );
       }
-      for ( auto const& rec : other.get_seq_to_edges() ) {
-        for ( auto const& elem : rec.second ) {
-          add( graph, elem, coord, true );
+      {
+        std::vector< std::pair< link_type, edge_type > > edges;
+        for ( auto const& rec : other.get_seq_to_edges() ) {
+          for ( auto const& elem : rec.second ) {
+            edges.push_back( make_edge( graph, elem, GFAFormat{}, coord, true ) );
+          }
         }
+        graph.add_edges_bulk( edges.begin(), edges.end() );
       }
       if ( sort ) {
         graph.sort_nodes();  // first, sort by ids
@@ -21,5 +21,7 @@
 
 #include "seqgraph.hpp"
 #include "seqgraph_interface.hpp"
+#include "seqgraph_overlay.hpp"
+#include "seqgraph_view.hpp"
 
 #endif  /* --- #ifndef GUM_GRAPH_HPP__ --- */
@@ -25,6 +25,10 @@
 #define  GUM_HG_UTILS_HPP__
 
 #include <string>
+#include <vector>
+#include <iterator>
+#include <utility>
+#include <unordered_map>
 
 #include "coordinate.hpp"
 #include "iterators.hpp"
@@ -186,6 +190,32 @@ namespace gum {
     inline void
     add_edge( TGraph& graph, HGFormat::nid_t from, bool from_start, HGFormat::nid_t to,
               bool to_end, HGFormat::off_t overlap, HGFormat, TCoordinate&& coord={}, bool force=false )
+    {
+      auto edge = make_edge( graph, from, from_start, to, to_end, overlap, HGFormat{}, coord, force );
+      graph.add_edge( edge.first, edge.second );
+    }
+
+    /**
+     *  @brief  Make the link and edge property of an external edge (HashGraph overload).
+     *
+     *  @param  graph Graph of any native type with Dynamic spec tag
+     *  @param  from External edge 'from' id
+     *  @param  from_start External edge from side
+     *  @param  to External edge 'to' id
+     *  @param  to_end External edge to side
+     *  @param  tag Format specifier tag
+     *  @param  coord Coorindate system converting the given node ids to graph local ids
+     *  @param  force Force node creation if any adjacent node does not exist in the graph
+     *  @return The pair of the link and the edge property to be added to the graph.
+     *
+     *  The adjacent nodes are created (if forced) but the edge itself is not added.
+     */
+    template< typename TGraph,
+              typename TCoordinate=HGFormat::DefaultCoord< TGraph >,
+              typename=std::enable_if_t< std::is_same< typename TGraph::spec_type, Dynamic >::value > >
+    inline std::pair< typename TGraph::link_type, typename TGraph::edge_type >
+    make_edge( TGraph& graph, HGFormat::nid_t from, bool from_start, HGFormat::nid_t to,
+               bool to_end, HGFormat::off_t overlap, HGFormat, TCoordinate&& coord={}, bool force=false )
     {
       using graph_type = TGraph;
       using id_type = typename graph_type::id_type;
@@ -205,7 +235,7 @@ namespace gum {
         sink = graph.add_node( sink );
         coord( to, sink );
       }
-      graph.add_edge( link_type( src, !from_start, sink, to_end ), edge_type( overlap ) );
+      return { link_type( src, !from_start, sink, to_end ), edge_type( overlap ) };
     }
 
     /**
@@ -311,19 +341,57 @@ namespace gum {
       using hg_handle_t = decltype( THGGraph{}.get_handle( HGFormat::nid_t{} ) );
       using hg_edge_t = decltype( THGGraph{}.edge_handle( hg_handle_t{}, hg_handle_t{} ) );
 
-      other.for_each_handle(
-          [&]( hg_handle_t const& handle ) -> bool {
-            add_node( graph, other.get_id( handle ), other.get_sequence( handle ), HGFormat{},
-                      coord, true );
-            return true;
-          } );
-      other.for_each_edge(
-          [&]( hg_edge_t const& edge ) -> bool {
-            add_edge( graph, other.get_id( edge.first ), other.get_is_reverse( edge.first ),
-                      other.get_id( edge.second ), other.get_is_reverse( edge.second ),
-                      0 /* no overlap */, HGFormat{}, coord );
-            return true;
-          } );
+      using graph_type = TGraph;
+      using id_type = typename graph_type::id_type;
+      using node_type = typename graph_type::node_type;
+      using link_type = typename graph_type::link_type;
+      using edge_type = typename graph_type::edge_type;
+
+      {
+        std::vector< std::pair< node_type, id_type > > nodes;
+        std::vector< HGFormat::nid_t > eids;
+        // Indices in `nodes` of the records seen so far in this batch
+        std::unordered_map< id_type, std::size_t > batch_ids;
+        std::unordered_map< HGFormat::nid_t, std::size_t > batch_eids;
+        nodes.reserve( other.get_node_count() );
+        eids.reserve( other.get_node_count() );
+        other.for_each_handle(
+            [&]( hg_handle_t const& handle ) -> bool {
+              HGFormat::nid_t eid = other.get_id( handle );
+              id_type id = coord( eid );
+              if ( graph.has_node( id ) ) {  // forced update
+                graph.update_node( id, node_type( other.get_sequence( handle ) ) );
+                return true;
+              }
+              std::size_t idx = nodes.size();
+              if ( id != 0 ) idx = batch_ids.emplace( id, idx ).first->second;
+              else idx = batch_eids.emplace( eid, idx ).first->second;
+              if ( idx != nodes.size() ) {  // forced update of a repeated record
+                nodes[ idx ].first = node_type( other.get_sequence( handle ) );
+                return true;
+              }
+              nodes.emplace_back( node_type( other.get_sequence( handle ) ), id );
+              eids.push_back( eid );
+              return true;
+            } );
+        auto eid_itr = eids.begin();
+        graph.add_nodes_bulk( std::make_move_iterator( nodes.begin() ),
+                              std::make_move_iterator( nodes.end() ),
+                              [&coord, &eid_itr]( id_type id ) { coord( *eid_itr++, id ); } );
+      }
+      {
+        std::vector< std::pair< link_type, edge_type > > edges;
+        edges.reserve( other.get_edge_count() );
+        other.for_each_edge(
+            [&]( hg_edge_t const& edge ) -> bool {
+              edges.push_back(
+                  make_edge( graph, other.get_id( edge.first ), other.get_is_reverse( edge.first ),
+                             other.get_id( edge.second ), other.get_is_reverse( edge.second ),
+                             0 /* no overlap */, HGFormat{}, coord ) );
+              return true;
+            } );
+        graph.add_edges_bulk( edges.begin(), edges.end() );
+      }
       if ( sort ) {
         graph.sort_nodes();  // first, sort by ids
         gum::util::topological_sort( graph, true );
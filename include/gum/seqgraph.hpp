@@ -19,6 +19,10 @@
 #define  GUM_SEQGRAPH_HPP__
 
 #include <algorithm>
+#include <numeric>
+#include <variant>
+#include <atomic>
+#include <mutex>
 
 #include "seqgraph_base.hpp"
 
@@ -30,6 +34,12 @@ namespace gum {
    *  Represent the connectivity of a bidirected graph in a dynamic way; i.e.
    *  the connectivity can be modified after it is constructed in contrast with
    *  `succinct` specialization which is immutable.
+   *
+   *  Removed nodes are left as tombstones in the node rank list; so the ranks
+   *  of the remaining nodes are not changed by removal, but they are no longer
+   *  contiguous. Calling `compact` renumbers the ranks and releases the space
+   *  occupied by tombstones. Algorithms indexing data by node ranks (and
+   *  conversion to other graph representations) require a compact graph.
    */
   template< typename TDir, typename TCoordSpec, uint8_t ...TWidths >
   class DirectedGraph< Dynamic, TDir, TCoordSpec, TWidths... > {
@@ -50,7 +60,10 @@ namespace gum {
     using link_type = typename trait_type::link_type;
     using linktype_type = typename trait_type::linktype_type;
     using adjs_type = typename trait_type::adjs_type;
+    using handle_type = typename trait_type::handle_type;
+    using handles_type = typename trait_type::handles_type;
     using adj_map_type = typename trait_type::adj_map_type;
+    using edge_handle_type = link_type;
     using coordspec_type = std::conditional_t< std::is_same< TCoordSpec, void >::value,
                                                coordinate::Identity, TCoordSpec >;
     using coordinate_type = CoordinateType< DirectedGraph, coordspec_type >;
@@ -61,18 +74,29 @@ namespace gum {
     template< typename TCSpec = coordspec_type >
     using dynamic_template = DirectedGraph< Dynamic, dir_type, TCSpec, TWidths... >;
 
+    template< typename TCSpec = void >
+    using compressed_template = DirectedGraph< Compressed, dir_type, TCSpec, TWidths... >;
+
     using succinct_type = succinct_template<>;
     using dynamic_type = dynamic_template<>;
+    using compressed_type = compressed_template<>;
 
     /* === LIFECYCLE === */
     DirectedGraph( )                                            /* constructor      */
-      : node_count( 0 ), edge_count( 0 )
+      : node_count( 0 ), edge_count( 0 ), max_id( 0 )
     {
       trait_type::init_rank_map( this->node_rank );
       trait_type::init_adj_map( this->adj_in );
       trait_type::init_adj_map( this->adj_out );
     }
 
+    template< typename TCSpec >
+    DirectedGraph( succinct_template< TCSpec > const& s_graph )
+      : DirectedGraph( )
+    {
+      this->construct( s_graph );
+    }
+
     DirectedGraph( DirectedGraph const& other ) = default;      /* copy constructor */
     DirectedGraph( DirectedGraph&& other ) noexcept = default;  /* move constructor */
     ~DirectedGraph() noexcept = default;                        /* destructor       */
@@ -90,6 +114,19 @@ namespace gum {
       return this->node_count;
     }
 
+    /**
+     *  @brief  Return the maximum node rank.
+     *
+     *  Node ranks are not renumbered on node removal until `compact` is called.
+     *  So, it is larger than the node count if the graph is not compact. Data
+     *  indexed by node rank should be sized by this value.
+     */
+    inline rank_type
+    get_max_rank( ) const
+    {
+      return this->nodes.size();
+    }
+
     inline rank_type
     get_edge_count( ) const
     {
@@ -106,6 +143,14 @@ namespace gum {
     DirectedGraph& operator=( DirectedGraph const& other ) = default;      /* copy assignment operator */
     DirectedGraph& operator=( DirectedGraph&& other ) noexcept = default;  /* move assignment operator */
 
+    template< typename TCSpec >
+    inline DirectedGraph&
+    operator=( succinct_template< TCSpec > const& s_graph )
+    {
+      this->construct( s_graph );
+      return *this;
+    }
+
     /* === METHODS === */
     /**
      *  @brief  Return the rank of a node by its ID.
@@ -117,9 +162,7 @@ namespace gum {
     id_to_rank( id_type id ) const
     {
       assert( id > 0 );
-      auto found = this->node_rank.find( id );
-      if ( found == this->node_rank.end() ) return 0;
-      return found->second;
+      return this->node_rank.get( id );
     }
 
     /**
@@ -127,7 +170,8 @@ namespace gum {
      *
      *  NOTE: This function assumes that node rank is within the range
      *  [1, node_count], otherwise the behaviour is undefined. The node rank
-     *  should be verified beforehand.
+     *  should be verified beforehand. If the graph is not compact, the range is
+     *  [1, nodes.size()] and zero is returned for the ranks of removed nodes.
      *
      *  @param  rank A node rank.
      *  @return The corresponding node ID.
@@ -135,8 +179,8 @@ namespace gum {
     inline id_type
     rank_to_id( rank_type rank ) const
     {
-      assert( 0 < rank && rank <= this->node_count );
-      return this->nodes[ rank - 1 ];
+      assert( 0 < rank && rank <= this->nodes.size() );
+      return this->nodes[ this->rank_to_index( rank ) ];
     }
 
     /**
@@ -185,8 +229,11 @@ namespace gum {
     successor_id( id_type id ) const
     {
       rank_type rank = this->id_to_rank( id );
-      if ( rank == this->node_count ) return 0;
-      return this->rank_to_id( rank + 1 );
+      while ( rank < this->nodes.size() ) {
+        id_type next = this->nodes[ this->rank_to_index( ++rank ) ];
+        if ( next != 0 ) return next;  // skip tombstones
+      }
+      return 0;
     }
 
     /**
@@ -196,9 +243,9 @@ namespace gum {
      *  not been already in the graph. If `ext_id` is not specified or is zero,
      *  the node ID are chosen internally.
      *
-     *  NOTE: The time complexity of adding node is constant if either no ID or
-     *  all IDs are specified externally. Switching between these two approaches
-     *  may result going through all nodes to determine the new node ID.
+     *  NOTE: Internally chosen IDs are assigned sequentially after the ID of the
+     *  last added node; or after the maximum ID in the graph if that one is
+     *  already taken.
      *
      *  @param  ext_id External node id.
      *  @return The node ID of the added node in the graph.
@@ -232,10 +279,32 @@ namespace gum {
       this->set_last_rank( count );
     }
 
+    /**
+     *  @brief  Add nodes with the IDs in the range [begin, end) to the graph.
+     *
+     *  Zero IDs in the range are chosen internally as in `add_node`. The nodes
+     *  and rank map are reserved once for the whole range, and each node is
+     *  ranked by a single insertion into the rank map.
+     *
+     *  @param  begin The begin iterator of the range of external node IDs.
+     *  @param  end The end iterator of the range of external node IDs.
+     *  @param  callback A function to be called on IDs of added nodes in order.
+     */
+    template< typename TIter, typename TCallback = void(*)( id_type ) >
+    inline void
+    add_nodes_bulk( TIter begin, TIter end,
+                    TCallback callback = []( id_type ){} )
+    {
+      static_assert( std::is_invocable_v< TCallback, id_type >, "received a non-invocable as callback" );
+
+      this->reserve_nodes( std::distance( begin, end ) );
+      for ( ; begin != end; ++begin ) callback( this->add_ranked_node_imp( *begin ) );
+    }
+
     inline bool
     has_node( id_type id ) const
     {
-      return this->node_rank.find( id ) != this->node_rank.end();
+      return this->node_rank.contains( id );
     }
 
     inline bool
@@ -258,9 +327,17 @@ namespace gum {
     {
       static_assert( std::is_invocable_r_v< bool, TCallback, rank_type, id_type >, "received a non-invocable as callback" );
 
+      if ( !this->order.empty() ) {
+        for ( rank_type rank = s_rank; rank <= this->nodes.size(); ++rank ) {
+          id_type id = this->nodes[ this->order[ rank - 1 ] ];
+          if ( id != 0 && !callback( rank, id ) ) return false;
+        }
+        return true;
+      }
+
       rank_type rank = 1;
       for ( id_type id : this->nodes ) {
-        if ( rank >= s_rank && !callback( rank, id ) ) return false;
+        if ( id != 0 && rank >= s_rank && !callback( rank, id ) ) return false;
         ++rank;
       }
       return true;
@@ -420,17 +497,37 @@ namespace gum {
       this->add_edge( this->from_side( sides ), this->to_side( sides ) );
     }
 
+    /**
+     *  @brief  Add edges in the range [begin, end) to the graph.
+     *
+     *  Repeated links in the range and the ones already in the graph are
+     *  skipped. The edges are added in the order of the range.
+     *
+     *  @param  begin The begin iterator of the range of links.
+     *  @param  end The end iterator of the range of links.
+     */
+    template< typename TIter >
+    inline void
+    add_edges_bulk( TIter begin, TIter end )
+    {
+      this->add_edges_bulk_imp( begin, end,
+                                []( link_type const& sides ) { return sides; },
+                                []( link_type const& ) { } );
+    }
+
     inline bool
     has_edge( side_type from, side_type to ) const
     {
-      auto oit = this->adj_out.find( from );
-      auto iit = this->adj_in.find( to );
+      handle_type from_handle = trait_type::handle_of( from );
+      handle_type to_handle = trait_type::handle_of( to );
+      auto oit = this->adj_out.find( from_handle );
+      auto iit = this->adj_in.find( to_handle );
       if ( oit == this->adj_out.end() || iit == this->adj_in.end() ) return false;
       auto const& outs = oit->second;
       auto const& ins = iit->second;
       if ( outs.size() < ins.size() )
-        return std::find( outs.begin(), outs.end(), to ) != outs.end();
-      return std::find( ins.begin(), ins.end(), from ) != ins.end();
+        return std::find( outs.begin(), outs.end(), to_handle ) != outs.end();
+      return std::find( ins.begin(), ins.end(), from_handle ) != ins.end();
     }
 
     inline bool
@@ -440,25 +537,94 @@ namespace gum {
     }
 
     inline bool
-    has_edge( id_type from, id_type to, linktype_type type=trait_type::get_default_linktype() )
+    has_edge( id_type from, id_type to, linktype_type type=trait_type::get_default_linktype() ) const
     {
       return this->has_edge( this->from_side( from, type ), this->to_side( to, type ) );
     }
 
+    /**
+     *  @brief  Remove a node and all of its incident edges.
+     *
+     *  The node is left as a tombstone in the node rank list. The ranks of
+     *  other nodes are unchanged until the graph is compacted.
+     *
+     *  @param  id The ID of the node to be removed.
+     */
+    inline void
+    remove_node( id_type id )
+    {
+      this->remove_node_imp( id, []( link_type ) { } );
+    }
+
+    /**
+     *  @brief  Remove an edge.
+     *
+     *  The adjacency lists keep their order. The time complexity is linear in
+     *  the degree of the incident sides.
+     */
+    inline void
+    remove_edge( side_type from, side_type to )
+    {
+      assert( this->has_edge( from, to ) );
+      handle_type from_handle = trait_type::handle_of( from );
+      handle_type to_handle = trait_type::handle_of( to );
+      DirectedGraph::erase_adjacent( this->adj_out, from_handle, to_handle );
+      DirectedGraph::erase_adjacent( this->adj_in, to_handle, from_handle );
+      --this->edge_count;
+    }
+
+    inline void
+    remove_edge( link_type sides )
+    {
+      this->remove_edge( this->from_side( sides ), this->to_side( sides ) );
+    }
+
+    inline void
+    remove_edge( id_type from, id_type to, linktype_type type=trait_type::get_default_linktype() )
+    {
+      this->remove_edge( this->from_side( from, type ), this->to_side( to, type ) );
+    }
+
+    /**
+     *  @brief  Check whether the node ranks are contiguous; i.e. no tombstones.
+     */
+    inline bool
+    is_compact( ) const
+    {
+      return this->nodes.size() == this->node_count;
+    }
+
+    /**
+     *  @brief  Drop tombstones of removed nodes and renumber node ranks.
+     *
+     *  The relative order of the remaining nodes is preserved. The space of
+     *  adjacency maps freed by removals is also released.
+     */
+    inline void
+    compact( )
+    {
+      this->apply_order();
+      if ( !this->is_compact() ) {
+        this->nodes.erase( std::remove( this->nodes.begin(), this->nodes.end(), 0 ),
+                           this->nodes.end() );
+        this->nodes.shrink_to_fit();
+        this->node_count = 0;
+        this->set_rank();
+      }
+      this->adj_out.rehash( 0 );
+      this->adj_in.rehash( 0 );
+    }
+
     inline adjs_type
     adjacents_out( side_type from ) const
     {
-      auto found = this->adj_out.find( from );
-      if ( found == this->adj_out.end() ) return adjs_type();
-      return found->second;
+      return DirectedGraph::unpack_adjacents( this->adj_out, from );
     }
 
     inline adjs_type
     adjacents_in( side_type to ) const
     {
-      auto found = this->adj_in.find( to );
-      if ( found == this->adj_in.end() ) return adjs_type();
-      return found->second;
+      return DirectedGraph::unpack_adjacents( this->adj_in, to );
     }
 
     /**
@@ -479,10 +645,10 @@ namespace gum {
     {
       static_assert( std::is_invocable_r_v< bool, TCallback, side_type >, "received a non-invocable as callback" );
 
-      auto found = this->adj_out.find( from );
+      auto found = this->adj_out.find( trait_type::handle_of( from ) );
       if ( found == this->adj_out.end() ) return true;
-      for ( side_type to : found->second ) {
-        if ( !callback( to ) ) return false;
+      for ( handle_type to : found->second ) {
+        if ( !callback( trait_type::side_of( to ) ) ) return false;
       }
       return true;
     }
@@ -492,7 +658,9 @@ namespace gum {
      *
      *  The `callback` function should get the outgoing node ID and the edge
      *  type; and return `true` to continue the iteration, and `false` to stop
-     *  it.
+     *  it. If the `callback` also accepts a third argument, the edge handle is
+     *  passed too which can be used for accessing edge properties directly
+     *  (e.g. `edge_overlap( handle )`) without looking up the edge again.
      *
      *  @param  id  The node ID whose outgoing edges are considered.
      *  @param  callback  The `callback` function.
@@ -504,15 +672,20 @@ namespace gum {
     for_each_edges_out( id_type id,
                         TCallback callback ) const
     {
-      static_assert( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type >, "received a non-invocable as callback" );
+      static_assert( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type > ||
+                     std::is_invocable_r_v< bool, TCallback, id_type, linktype_type, edge_handle_type >,
+                     "received a non-invocable as callback" );
 
       return this->for_each_side(
           id,
           [this, callback]( side_type from ) {
-            auto found = this->adj_out.find( from );
+            auto found = this->adj_out.find( trait_type::handle_of( from ) );
             if ( found == this->adj_out.end() ) return true;
-            for ( side_type to : found->second ) {
-              if ( !callback( this->id_of( to ), this->linktype( from, to ) ) )
+            for ( handle_type handle : found->second ) {
+              side_type to = trait_type::side_of( handle );
+              if ( !this->call_edge_callback( callback, this->id_of( to ),
+                                              this->linktype( from, to ),
+                                              this->make_link( from, to ) ) )
                 return false;
             }
             return true;
@@ -537,10 +710,10 @@ namespace gum {
     {
       static_assert( std::is_invocable_r_v< bool, TCallback, side_type >, "received a non-invocable as callback" );
 
-      auto found = this->adj_in.find( to );
+      auto found = this->adj_in.find( trait_type::handle_of( to ) );
       if ( found == this->adj_in.end() ) return true;
-      for ( side_type from : found->second ) {
-        if ( !callback( from ) ) return false;
+      for ( handle_type from : found->second ) {
+        if ( !callback( trait_type::side_of( from ) ) ) return false;
       }
       return true;
     }
@@ -550,7 +723,9 @@ namespace gum {
      *
      *  The `callback` function should get the incoming node ID and the edge
      *  type; and return `true` to continue the iteration, and `false` to stop
-     *  it.
+     *  it. If the `callback` also accepts a third argument, the edge handle is
+     *  passed too which can be used for accessing edge properties directly
+     *  (e.g. `edge_overlap( handle )`) without looking up the edge again.
      *
      *  @param  id  The node ID whose incoming edges are considered.
      *  @param  callback  The `callback` function.
@@ -562,15 +737,20 @@ namespace gum {
     for_each_edges_in( id_type id,
                        TCallback callback ) const
     {
-      static_assert( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type >, "received a non-invocable as callback" );
+      static_assert( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type > ||
+                     std::is_invocable_r_v< bool, TCallback, id_type, linktype_type, edge_handle_type >,
+                     "received a non-invocable as callback" );
 
       return this->for_each_side(
           id,
           [this, callback]( side_type to ) {
-            auto found = this->adj_in.find( to );
+            auto found = this->adj_in.find( trait_type::handle_of( to ) );
             if ( found == this->adj_in.end() ) return true;
-            for ( side_type from : found->second ) {
-              if ( !callback( this->id_of( from ), this->linktype( from, to ) ) )
+            for ( handle_type handle : found->second ) {
+              side_type from = trait_type::side_of( handle );
+              if ( !this->call_edge_callback( callback, this->id_of( from ),
+                                              this->linktype( from, to ),
+                                              this->make_link( from, to ) ) )
                 return false;
             }
             return true;
@@ -580,7 +760,7 @@ namespace gum {
     inline rank_type
     outdegree( side_type side ) const
     {
-      auto found = this->adj_out.find( side );
+      auto found = this->adj_out.find( trait_type::handle_of( side ) );
       if ( found == this->adj_out.end() ) return 0;
       return found->second.size();
     }
@@ -602,7 +782,7 @@ namespace gum {
     inline rank_type
     indegree( side_type side ) const
     {
-      auto found = this->adj_in.find( side );
+      auto found = this->adj_in.find( trait_type::handle_of( side ) );
       if ( found == this->adj_in.end() ) return 0;
       return found->second.size();
     }
@@ -669,31 +849,86 @@ namespace gum {
       return this->indegree( side ) > 1;
     }
 
+    /**
+     *  @brief  Reorder nodes such that the node at rank `perm[i] + 1` gets rank `i + 1`.
+     *
+     *  Nodes are moved out of place and the rank map is rebuilt, both in
+     *  parallel.
+     */
     template< typename TContainer >
     inline void
     sort_nodes( TContainer const& perm )
     {
-      util::permute( perm, this->nodes );
+      this->sort_nodes( perm, Lazy{} );
+      this->apply_order();
+    }
+
+    /**
+     *  @brief  Reorder node ranks by `perm` without moving the nodes.
+     *
+     *  Only the rank map is rebuilt, and the new order is kept aside; i.e. node
+     *  ranks are translated to their storage positions afterwards. This saves
+     *  moving the data when the graph is about to be converted to a Succinct
+     *  one. Compacting or sorting the graph by IDs apply the order first (see
+     *  `apply_order`). Until then, `get_nodes` returns nodes in their storage
+     *  order rather than by rank.
+     */
+    template< typename TContainer >
+    inline void
+    sort_nodes( TContainer const& perm, Lazy )
+    {
+      assert( perm.size() == this->nodes.size() );
+
+      std::vector< size_type > new_order( perm.size() );
+      #pragma omp parallel for schedule( static )
+      for ( size_type i = 0; i < new_order.size(); ++i ) {
+        new_order[ i ] = this->rank_to_index( perm[ i ] + 1 );
+      }
+      this->order = std::move( new_order );
       this->reset_ranks();
     }
 
     inline auto
     sort_nodes( )
     {
+      this->apply_order();
       auto perm = util::sort_permutation( this->nodes );  // sort by node ids
       this->sort_nodes( perm );
       return perm;
     }
 
+    /**
+     *  @brief  Move nodes to their rank order set by a lazy `sort_nodes`, if any.
+     */
+    inline void
+    apply_order( )
+    {
+      if ( this->order.empty() ) return;
+      util::permute_parallel( this->order, this->nodes );
+      this->order.clear();
+      this->order.shrink_to_fit();
+    }
+
+    /**
+     *  @brief  Whether the order set by a lazy `sort_nodes` is not applied yet.
+     */
+    inline bool
+    has_pending_order( ) const
+    {
+      return !this->order.empty();
+    }
+
     inline void
     clear( )
     {
       this->nodes.clear();
+      this->order.clear();
       this->node_rank.clear();
       this->adj_out.clear();
       this->adj_in.clear();
       this->node_count = 0;
       this->edge_count = 0;
+      this->max_id = 0;
     }
 
     inline void
@@ -720,28 +955,46 @@ namespace gum {
     inline id_type
     add_node_imp( id_type ext_id=0 )
     {
-      if ( ext_id == 0 ) {                      // ID is not externally specified.
-        if ( this->nodes.empty() ) ext_id = 1;  // IDs start from 1.
-        else {
-          ext_id = this->nodes.back() + 1;      // and they are assigned sequentially.
-          if ( this->has_node( ext_id ) ) {     // Otherwise, find the max (expensive).
-            ext_id = *std::max_element( this->nodes.begin(), this->nodes.end() ) + 1;
-          }
-        }
-      }
+      if ( ext_id == 0 ) ext_id = this->next_id();  // ID is not externally specified.
       if ( this->has_node( ext_id ) )
         throw std::runtime_error( "adding a node with invalid/duplicate ID" );
-      this->nodes.push_back( ext_id );
+      this->push_node( ext_id );
+      if ( this->max_id < ext_id ) this->max_id = ext_id;
+      return ext_id;
+    }
+
+    /**
+     *  @brief  Add a node and set its rank by a single insertion into the rank map.
+     */
+    inline id_type
+    add_ranked_node_imp( id_type ext_id=0 )
+    {
+      if ( ext_id == 0 ) ext_id = this->next_id();
+      if ( !this->node_rank.insert( ext_id, this->nodes.size() + 1 ) )
+        throw std::runtime_error( "adding a node with invalid/duplicate ID" );
+      this->push_node( ext_id );
+      if ( this->max_id < ext_id ) this->max_id = ext_id;
+      ++this->node_count;
       return ext_id;
     }
 
+    inline void
+    reserve_nodes( size_type count )
+    {
+      this->nodes.reserve( this->nodes.size() + count );
+      if ( !this->order.empty() ) this->order.reserve( this->order.size() + count );
+      this->node_rank.reserve( this->node_rank.size() + count );
+    }
+
     inline void
     add_edge_imp( side_type from, side_type to, bool safe=true )
     {
       assert( this->has_node( from ) && this->has_node( to ) );
       assert( !safe || !this->has_edge( from, to ) );
-      this->adj_out[ from ].push_back( to );
-      this->adj_in[ to ].push_back( from );
+      handle_type from_handle = trait_type::handle_of( from );
+      handle_type to_handle = trait_type::handle_of( to );
+      this->adj_out[ from_handle ].push_back( to_handle );
+      this->adj_in[ to_handle ].push_back( from_handle );
       ++this->edge_count;
     }
 
@@ -751,41 +1004,187 @@ namespace gum {
       this->add_edge_imp( this->from_side( sides ), this->to_side( sides ), safe );
     }
 
+    /**
+     *  @brief  Add the edges of elements in the range [begin, end).
+     *
+     *  The link of each element is given by `get_link`. Repeated links are found
+     *  by sorting them instead of querying the graph for each; the graph is only
+     *  queried when it already has some edges. The `callback` is called on each
+     *  element whose edge is added, in the order of the range.
+     */
+    template< typename TIter, typename TGetLink, typename TCallback >
+    inline void
+    add_edges_bulk_imp( TIter begin, TIter end, TGetLink get_link, TCallback callback )
+    {
+      std::vector< link_type > links;
+      links.reserve( std::distance( begin, end ) );
+      for ( auto itr = begin; itr != end; ++itr ) links.push_back( get_link( *itr ) );
+
+      std::vector< size_type > order( links.size() );
+      std::iota( order.begin(), order.end(), 0 );
+      std::stable_sort( order.begin(), order.end(),
+                        [&links]( size_type i, size_type j ) { return links[ i ] < links[ j ]; } );
+      std::vector< bool > skip( links.size(), false );
+      bool query = this->edge_count != 0;
+      for ( size_type k = 0; k < order.size(); ++k ) {
+        size_type i = order[ k ];
+        if ( k != 0 && links[ i ] == links[ order[ k - 1 ] ] ) skip[ i ] = true;
+        else if ( query && this->has_edge( links[ i ] ) ) skip[ i ] = true;
+      }
+
+      this->adj_out.reserve( this->adj_out.size() + links.size() );
+      this->adj_in.reserve( this->adj_in.size() + links.size() );
+      size_type i = 0;
+      for ( auto itr = begin; itr != end; ++itr, ++i ) {
+        if ( skip[ i ] ) continue;
+        this->add_edge_imp( links[ i ], false );
+        callback( *itr );
+      }
+    }
+
+    /**
+     *  @brief  Remove a node and call `callback` on each of its removed edges.
+     */
+    template< typename TCallback >
+    inline void
+    remove_node_imp( id_type id, TCallback callback )
+    {
+      static_assert( std::is_invocable_v< TCallback, link_type >, "received a non-invocable as callback" );
+
+      rank_type rank = this->id_to_rank( id );
+      if ( rank == 0 ) throw std::runtime_error( "removing a non-existent node" );
+      this->for_each_side(
+          id,
+          [this, &callback]( side_type side ) {
+            handle_type handle = trait_type::handle_of( side );
+            auto found = this->adj_out.find( handle );
+            if ( found != this->adj_out.end() ) {
+              for ( handle_type to : found->second ) {
+                DirectedGraph::erase_adjacent( this->adj_in, to, handle );
+                callback( this->make_link( side, trait_type::side_of( to ) ) );
+                --this->edge_count;
+              }
+              this->adj_out.erase( found );
+            }
+            found = this->adj_in.find( handle );
+            if ( found != this->adj_in.end() ) {
+              for ( handle_type from : found->second ) {
+                DirectedGraph::erase_adjacent( this->adj_out, from, handle );
+                callback( this->make_link( trait_type::side_of( from ), side ) );
+                --this->edge_count;
+              }
+              this->adj_in.erase( found );
+            }
+            return true;
+          } );
+      this->nodes[ this->rank_to_index( rank ) ] = 0;  // leave a tombstone
+      this->node_rank.erase( id );
+      --this->node_count;
+    }
+
   private:
     /* === DATA MEMBERS === */
     nodes_type nodes;
+    std::vector< size_type > order;  /**< @brief Storage index of nodes by rank set by a lazy `sort_nodes` */
     rank_map_type node_rank;
     adj_map_type adj_out;
     adj_map_type adj_in;
     rank_type node_count;
     rank_type edge_count;
+    id_type max_id;  /**< @brief An upper bound of node IDs in the graph */
     coordinate_type coordinate;
 
     /* === METHODS === */
+    /**
+     *  @brief  Choose the ID of a node to be added when it is not externally specified.
+     *
+     *  IDs start from 1 and are assigned sequentially. If the ID next to the
+     *  last added one is already taken, the one after the maximum ID is used.
+     */
+    inline id_type
+    next_id( ) const
+    {
+      if ( this->nodes.empty() ) return 1;
+      id_type ext_id = this->nodes.back() + 1;
+      if ( this->has_node( ext_id ) ) ext_id = this->max_id + 1;
+      return ext_id;
+    }
+
+    /**
+     *  @brief  Call an edge `callback` with or without the edge handle.
+     *
+     *  The edge handle is passed to the `callback` only if it accepts it as the
+     *  third argument.
+     */
+    template< typename TCallback >
+    static inline bool
+    call_edge_callback( TCallback const& callback, id_type adj_id, linktype_type type,
+                        edge_handle_type handle )
+    {
+      if constexpr ( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type, edge_handle_type > ) {
+        return callback( adj_id, type, handle );
+      }
+      else {
+        (void)handle;  // Silencing unused-parameter warning.
+        return callback( adj_id, type );
+      }
+    }
+
+    /**
+     *  @brief  Return the index of the node with the given rank in `nodes`.
+     */
+    inline size_type
+    rank_to_index( rank_type rank ) const
+    {
+      return this->order.empty() ? rank - 1 : this->order[ rank - 1 ];
+    }
+
+    inline void
+    push_node( id_type id )
+    {
+      if ( !this->order.empty() ) this->order.push_back( this->nodes.size() );
+      this->nodes.push_back( id );
+    }
+
     inline void
     reset_ranks()
     {
-      rank_type rank = 0;
-      for ( auto const& n : this->nodes ) this->node_rank[ n ] = ++rank;
+      if ( this->order.empty() ) {
+        this->node_rank.assign( this->nodes.begin(), this->nodes.end() );  // skips tombstones
+        return;
+      }
+      RandomAccessProxyContainer ids(
+          &this->order, [this]( size_type i ) -> id_type { return this->nodes[ i ]; } );
+      this->node_rank.assign( ids.begin(), ids.end() );
     }
 
     inline void
     set_rank( typename nodes_type::const_iterator begin,
               typename nodes_type::const_iterator end )
     {
-      assert( end - begin + this->node_count == this->nodes.size() );
+      assert( end == this->nodes.cend() );
+      rank_type rank = begin - this->nodes.cbegin();
       for ( ; begin != end; ++begin ) {
-        bool inserted;
-        std::tie( std::ignore, inserted ) =
-            this->node_rank.insert( { *begin, ++this->node_count } );
+        bool inserted = this->node_rank.insert( *begin, ++rank );
         assert( inserted );  // avoid duplicate insertion from upstream.
+        (void)inserted;  // Silencing unused-variable warning.
+        ++this->node_count;
       }
     }
 
+    /**
+     *  @brief  Rebuild the rank map for all nodes.
+     *
+     *  The rank map chooses its representation by the range of all node IDs at
+     *  once.
+     */
     inline void
     set_rank( )
     {
-      this->set_rank( this->nodes.begin(), this->nodes.end() );
+      bool unique = this->node_rank.assign( this->nodes.begin(), this->nodes.end() );
+      assert( unique );  // avoid duplicate insertion from upstream.
+      (void)unique;  // Silencing unused-variable warning.
+      this->node_count = this->node_rank.size();
     }
 
     inline void
@@ -793,6 +1192,152 @@ namespace gum {
     {
       this->set_rank( this->nodes.end() - count, this->nodes.end() );
     }
+
+    /**
+     *  @brief  Return the adjacency list of `side` in the map as sides.
+     */
+    static inline adjs_type
+    unpack_adjacents( adj_map_type const& adj_map, side_type side )
+    {
+      adjs_type adjs;
+      auto found = adj_map.find( trait_type::handle_of( side ) );
+      if ( found == adj_map.end() ) return adjs;
+      adjs.reserve( found->second.size() );
+      for ( handle_type adj : found->second ) adjs.push_back( trait_type::side_of( adj ) );
+      return adjs;
+    }
+
+    /**
+     *  @brief  Erase the first occurrence of `adj` from the adjacency list of `side`.
+     *
+     *  Both are given as packed handles. The entry of `side` is erased from the
+     *  map when its list gets empty.
+     */
+    static inline void
+    erase_adjacent( adj_map_type& adj_map, handle_type side, handle_type adj )
+    {
+      auto found = adj_map.find( side );
+      assert( found != adj_map.end() );
+      auto& adjs = found->second;
+      auto itr = std::find( adjs.begin(), adjs.end(), adj );
+      assert( itr != adjs.end() );
+      adjs.erase( itr );
+      if ( adjs.empty() ) adj_map.erase( found );
+    }
+
+    /**
+     *  @brief  Construct the dynamic graph from a Succinct one.
+     *
+     *  Node IDs are the embedded coordinate IDs of the Succinct graph; i.e.
+     *  the IDs of the `Dynamic` graph from which the Succinct one has been
+     *  constructed. Node ranks and the order of adjacency lists are preserved.
+     *
+     *  Node records are read in parallel into flat buffers laid out by node
+     *  degrees. Then, the hash maps are reserved and filled sequentially from
+     *  the buffers, since they cannot be populated concurrently.
+     *
+     *  NOTE: Incoming edges are derived from the outgoing ones if the Succinct
+     *  graph neither stores them nor has an index built for them.
+     *
+     *  @param  s_graph A Succinct graph.
+     */
+    template< typename TCSpec >
+    inline void
+    construct( succinct_template< TCSpec > const& s_graph )
+    {
+      using buffer_type = std::vector< std::pair< handle_type, handle_type > >;
+
+      this->clear();
+      this->coordinate = coordinate_type();
+      rank_type count = s_graph.get_node_count();
+      bool has_in = !s_graph.is_out_only() || s_graph.has_in_index();
+      std::vector< size_type > out_pos( count + 1, 0 );
+      std::vector< size_type > in_pos( count + 1, 0 );
+      this->nodes.resize( count );
+
+      id_type max_id = 0;
+      #pragma omp parallel for schedule( static ) reduction( max:max_id )
+      for ( rank_type rank = 1; rank <= count; ++rank ) {
+        id_type s_id = s_graph.rank_to_id( rank );
+        this->nodes[ rank - 1 ] = s_graph.coordinate_id( s_id );
+        if ( max_id < this->nodes[ rank - 1 ] ) max_id = this->nodes[ rank - 1 ];
+        out_pos[ rank ] = s_graph.outdegree( s_id );
+        if ( has_in ) in_pos[ rank ] = s_graph.indegree( s_id );
+      }
+      std::partial_sum( out_pos.begin(), out_pos.end(), out_pos.begin() );
+      std::partial_sum( in_pos.begin(), in_pos.end(), in_pos.begin() );
+
+      buffer_type out_buf( out_pos.back() );
+      buffer_type in_buf( in_pos.back() );
+      #pragma omp parallel for schedule( dynamic, 1024 )
+      for ( rank_type rank = 1; rank <= count; ++rank ) {
+        id_type s_id = s_graph.rank_to_id( rank );
+        id_type id = this->nodes[ rank - 1 ];
+        auto out_itr = out_buf.begin() + out_pos[ rank - 1 ];
+        s_graph.for_each_edges_out(
+            s_id,
+            [&]( id_type to, linktype_type type ) {
+              *out_itr++ = {
+                  trait_type::handle_of( this->from_side( id, type ) ),
+                  trait_type::handle_of( this->to_side( s_graph.coordinate_id( to ), type ) ) };
+              return true;
+            } );
+        if ( !has_in ) continue;
+        auto in_itr = in_buf.begin() + in_pos[ rank - 1 ];
+        s_graph.for_each_edges_in(
+            s_id,
+            [&]( id_type from, linktype_type type ) {
+              *in_itr++ = {
+                  trait_type::handle_of( this->to_side( id, type ) ),
+                  trait_type::handle_of( this->from_side( s_graph.coordinate_id( from ), type ) ) };
+              return true;
+            } );
+      }
+      if ( !has_in ) {
+        // Group the derived in-edges by their side; so that each adjacency list is
+        // filled from a single run.
+        in_buf.reserve( out_buf.size() );
+        for ( auto const& sides : out_buf ) in_buf.emplace_back( sides.second, sides.first );
+        std::stable_sort( in_buf.begin(), in_buf.end(),
+                          []( auto const& a, auto const& b ) { return a.first < b.first; } );
+      }
+
+      this->max_id = max_id;
+      this->set_rank();
+      DirectedGraph::fill_adj_map( this->adj_out, out_buf );
+      DirectedGraph::fill_adj_map( this->adj_in, in_buf );
+      this->edge_count = s_graph.get_edge_count();
+    }
+
+    /**
+     *  @brief  Fill an adjacency map from a buffer of (side, adjacent side) handle pairs.
+     *
+     *  Pairs sharing the same side are expected to be mostly consecutive in the
+     *  buffer, which is used for reserving the map and its adjacency lists. Only
+     *  the first run of a side reserves its list exactly; later runs of the same
+     *  side grow it geometrically.
+     */
+    template< typename TBuffer >
+    static inline void
+    fill_adj_map( adj_map_type& adj_map, TBuffer const& buffer )
+    {
+      auto run_end =
+          [&buffer]( auto itr ) {
+            handle_type side = itr->first;
+            return std::find_if( itr, buffer.end(),
+                                 [&side]( auto const& sides ) { return sides.first != side; } );
+          };
+
+      size_type nof_runs = 0;
+      for ( auto itr = buffer.begin(); itr != buffer.end(); itr = run_end( itr ) ) ++nof_runs;
+      adj_map.reserve( nof_runs );
+      for ( auto itr = buffer.begin(); itr != buffer.end(); ) {
+        auto last = run_end( itr );
+        handles_type& adjs = adj_map[ itr->first ];
+        if ( adjs.empty() ) adjs.reserve( last - itr );
+        for ( ; itr != last; ++itr ) adjs.push_back( itr->second );
+      }
+    }
   };  /* --- end of template class DirectedGraph --- */
 
   /**
@@ -830,6 +1375,8 @@ namespace gum {
     using link_type = typename trait_type::link_type;
     using linktype_type = typename trait_type::linktype_type;
     using adjs_type = typename trait_type::adjs_type;
+    using edge_handle_type = size_type;
+    using pos_vector_type = sdsl::int_vector< >;
     using coordspec_type = std::conditional_t< std::is_same< TCoordSpec, void >::value,
                                                coordinate::Dense, TCoordSpec >;
     using coordinate_type = CoordinateType< DirectedGraph, coordspec_type >;
@@ -840,28 +1387,51 @@ namespace gum {
     template< typename TCSpec = coordspec_type >
     using succinct_template = DirectedGraph< Succinct, dir_type, TCSpec, TWidths... >;
 
+    template< typename TCSpec = void >
+    using compressed_template = DirectedGraph< Compressed, dir_type, TCSpec, TWidths... >;
+
     using dynamic_type = dynamic_template<>;
     using succinct_type = succinct_template<>;
+    using compressed_type = compressed_template<>;
 
     /* === LIFECYCLE  === */
-    DirectedGraph( padding_type npadding = 0, padding_type epadding = 0 )
+    DirectedGraph( padding_type npadding = 0, padding_type epadding = 0,
+                   bool out_only = false )
       : np_padding( npadding ),
         ep_padding( epadding ),
+        out_only( out_only ),
+        forward_only( false ),
         node_count( 0 ),
         edge_count( 0 ),
         nodes( nodes_type( 1, 0 ) ),
-        ids_bv( bv_type( 1, 0 ) )
+        ids_bv( bv_type( 1, 0 ) ),
+        in_indexed( false )
     {
       sdsl::util::init_support( this->node_rank, &this->ids_bv );
       sdsl::util::init_support( this->node_id, &this->ids_bv );
     }
 
+    /**
+     *  @brief  Construct the succinct graph from a Dynamic one.
+     *
+     *  If `out_only` is set, only outgoing edges are stored in the node records
+     *  which roughly halves the memory required for the edges. Incoming edges
+     *  are still accessible through an index which is built on demand (see
+     *  `build_in_index`).
+     *
+     *  If all edges of `d_graph` are of the default link type (i.e. end to
+     *  start), the link type field is dropped from the edge entries (see
+     *  `is_forward_only`).
+     */
     template< typename TCSpec >
     DirectedGraph( dynamic_template< TCSpec > const& d_graph,
                    padding_type npadding = 0,
-                   padding_type epadding = 0 )
+                   padding_type epadding = 0,
+                   bool out_only = false )
       : np_padding( npadding ),
-        ep_padding( epadding )
+        ep_padding( epadding ),
+        out_only( out_only ),
+        in_indexed( false )
     {
       this->construct( d_graph );
     }
@@ -870,10 +1440,16 @@ namespace gum {
     DirectedGraph( DirectedGraph const& other )
       : np_padding( other.np_padding ),
         ep_padding( other.ep_padding ),
+        out_only( other.out_only ),
+        forward_only( other.forward_only ),
         node_count( other.node_count ),
         edge_count( other.edge_count ),
         nodes( other.nodes ),
-        ids_bv( other.ids_bv )
+        ids_bv( other.ids_bv ),
+        coordinate( other.coordinate ),
+        in_indexed( other.in_indexed.load( std::memory_order_acquire ) ),
+        in_starts( other.in_starts ),
+        in_edges( other.in_edges )
     {
       sdsl::util::init_support( this->node_rank, &this->ids_bv );
       sdsl::util::init_support( this->node_id, &this->ids_bv );
@@ -883,10 +1459,16 @@ namespace gum {
     DirectedGraph( DirectedGraph&& other ) noexcept
       : np_padding( other.np_padding ),
         ep_padding( other.ep_padding ),
+        out_only( other.out_only ),
+        forward_only( other.forward_only ),
         node_count( other.node_count ),
         edge_count( other.edge_count ),
         nodes( std::move( other.nodes ) ),
-        ids_bv( std::move( other.ids_bv ) )
+        ids_bv( std::move( other.ids_bv ) ),
+        coordinate( std::move( other.coordinate ) ),
+        in_indexed( other.in_indexed.load( std::memory_order_acquire ) ),
+        in_starts( std::move( other.in_starts ) ),
+        in_edges( std::move( other.in_edges ) )
     {
       sdsl::util::init_support( this->node_rank, &this->ids_bv );
       sdsl::util::init_support( this->node_id, &this->ids_bv );
@@ -902,12 +1484,27 @@ namespace gum {
     }
 
     /* === ACCESSORS === */
+    inline nodes_type const&
+    get_nodes( ) const
+    {
+      return this->nodes;
+    }
+
     inline rank_type
     get_node_count( ) const
     {
       return this->node_count;
     }
 
+    /**
+     *  @brief  Return the maximum node rank; i.e. the node count.
+     */
+    inline rank_type
+    get_max_rank( ) const
+    {
+      return this->node_count;
+    }
+
     inline rank_type
     get_edge_count( ) const
     {
@@ -920,19 +1517,86 @@ namespace gum {
       return this->coordinate;
     }
 
-    /* === OPERATORS === */
-    /* copy assignment operator */
-    DirectedGraph&
-    operator=( DirectedGraph const& other )
+    /**
+     *  @brief  Whether only outgoing edges are stored in the node records.
+     */
+    inline bool
+    is_out_only( ) const
     {
-      this->np_padding = other.np_padding;
-      this->ep_padding = other.ep_padding;
-      this->node_count = other.node_count;
-      this->edge_count = other.edge_count;
-      this->nodes = other.nodes;
-      this->ids_bv = other.ids_bv;
-      sdsl::util::init_support( this->node_rank, &this->ids_bv );
+      return this->out_only;
+    }
+
+    /**
+     *  @brief  Whether all edges are of the default link type.
+     *
+     *  In that case, the edge entries do not store the link type and the
+     *  default one is reported for all edges.
+     */
+    inline bool
+    is_forward_only( ) const
+    {
+      return this->forward_only;
+    }
+
+    /**
+     *  @brief  Return the number of property fields appended to each edge entry.
+     */
+    inline padding_type
+    get_edge_padding( ) const
+    {
+      return this->ep_padding;
+    }
+
+    /**
+     *  @brief  Whether incoming edges are accessible without building the index.
+     */
+    inline bool
+    has_in_index( ) const
+    {
+      return !this->out_only || this->in_indexed.load( std::memory_order_acquire );
+    }
+
+    /**
+     *  @brief  Return the size of the graph connectivity in bytes.
+     *
+     *  It counts the node records, the node ID bit vector with its rank/select
+     *  supports, and the in-edges index if built. The embedded coordinate
+     *  system is not counted.
+     */
+    inline std::size_t
+    size_in_bytes( ) const
+    {
+      std::size_t retval = sdsl::size_in_bytes( this->nodes )
+          + sdsl::size_in_bytes( this->ids_bv )
+          + sdsl::size_in_bytes( this->node_rank )
+          + sdsl::size_in_bytes( this->node_id );
+      if ( this->out_only && this->has_in_index() ) {
+        retval += sdsl::size_in_bytes( this->in_starts )
+            + sdsl::size_in_bytes( this->in_edges );
+      }
+      return retval;
+    }
+
+    /* === OPERATORS === */
+    /* copy assignment operator */
+    DirectedGraph&
+    operator=( DirectedGraph const& other )
+    {
+      this->np_padding = other.np_padding;
+      this->ep_padding = other.ep_padding;
+      this->out_only = other.out_only;
+      this->forward_only = other.forward_only;
+      this->node_count = other.node_count;
+      this->edge_count = other.edge_count;
+      this->nodes = other.nodes;
+      this->ids_bv = other.ids_bv;
+      this->coordinate = other.coordinate;
+      this->in_indexed.store( other.in_indexed.load( std::memory_order_acquire ), std::memory_order_release );
+      this->in_starts = other.in_starts;
+      this->in_edges = other.in_edges;
+      sdsl::util::init_support( this->node_rank, &this->ids_bv );
       sdsl::util::init_support( this->node_id, &this->ids_bv );
+      return *this;
     }
 
     /* move assignment operator */
@@ -941,14 +1605,21 @@ namespace gum {
     {
       this->np_padding = other.np_padding;
       this->ep_padding = other.ep_padding;
+      this->out_only = other.out_only;
+      this->forward_only = other.forward_only;
       this->node_count = other.node_count;
       this->edge_count = other.edge_count;
       this->nodes = std::move( other.nodes );
       this->ids_bv = std::move( other.ids_bv );
+      this->coordinate = std::move( other.coordinate );
+      this->in_indexed.store( other.in_indexed.load( std::memory_order_acquire ), std::memory_order_release );
+      this->in_starts = std::move( other.in_starts );
+      this->in_edges = std::move( other.in_edges );
       sdsl::util::init_support( this->node_rank, &this->ids_bv );
       sdsl::util::init_support( this->node_id, &this->ids_bv );
       sdsl::util::clear( other.node_rank );
       sdsl::util::clear( other.node_id );
+      return *this;
     }
 
     template< typename TCSpec >
@@ -1220,6 +1891,7 @@ namespace gum {
     has_edge( id_type from, id_type to, linktype_type type=trait_type::get_default_linktype() ) const
     {
       if ( !this->has_node( from ) || !this->has_node( to ) ) return false;
+      if ( this->forward_only && type != trait_type::get_default_linktype() ) return false;
       auto fod = this->outdegree( from );
       auto tod = this->indegree( to );
       auto findto =
@@ -1232,7 +1904,7 @@ namespace gum {
             if ( fid == from && ftype == type ) return false;
             return true;
           };
-      if ( fod < tod ) return !this->for_each_edges_out( from, findto );
+      if ( fod < tod || !this->has_in_index() ) return !this->for_each_edges_out( from, findto );
       else return !this->for_each_edges_in( to, findfrom );
     }
 
@@ -1298,6 +1970,9 @@ namespace gum {
     {
       static_assert( std::is_invocable_r_v< bool, TCallback, side_type >, "received a non-invocable as callback" );
 
+      if ( this->forward_only && !this->is_valid_from( from, trait_type::get_default_linktype() ) ) {
+        return true;
+      }
       return this->for_each_edges_out(
           this->id_of( from ),
           [this, from, callback]( id_type id, linktype_type type ) {
@@ -1313,7 +1988,9 @@ namespace gum {
      *
      *  The `callback` function should get the outgoing node ID and the edge
      *  type; and return `true` to continue the iteration, and `false` to stop
-     *  it.
+     *  it. If the `callback` also accepts a third argument, the edge handle is
+     *  passed too which can be used for accessing edge properties directly
+     *  (e.g. `edge_overlap( handle )`) without looking up the edge again.
      *
      *  @param  id  The node ID whose outgoing edges are considered.
      *  @param  callback  The `callback` function.
@@ -1325,14 +2002,25 @@ namespace gum {
     for_each_edges_out( id_type id,
                         TCallback callback ) const
     {
-      static_assert( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type >, "received a non-invocable as callback" );
+      static_assert( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type > ||
+                     std::is_invocable_r_v< bool, TCallback, id_type, linktype_type, edge_handle_type >,
+                     "received a non-invocable as callback" );
 
       if ( !this->has_edges_out( id ) ) return true;
+      if ( this->forward_only ) {
+        return this->for_each_edges_out_pos(
+            id,
+            [this, callback]( size_type pos ) {
+              return this->call_edge_callback( callback, this->get_adj_id( pos ),
+                                               trait_type::get_default_linktype(), pos );
+            }
+          );
+      }
       return this->for_each_edges_out_pos(
           id,
           [this, callback]( size_type pos ) {
-            return callback( this->get_adj_id( pos ),
-                             this->get_adj_linktype( pos ) );
+            return this->call_edge_callback( callback, this->get_adj_id( pos ),
+                                             this->get_adj_linktype( pos ), pos );
           }
         );
     }
@@ -1355,6 +2043,9 @@ namespace gum {
     {
       static_assert( std::is_invocable_r_v< bool, TCallback, side_type >, "received a non-invocable as callback" );
 
+      if ( this->forward_only && !this->is_valid_to( to, trait_type::get_default_linktype() ) ) {
+        return true;
+      }
       return this->for_each_edges_in(
           this->id_of( to ),
           [this, to, callback]( id_type id, linktype_type type ) {
@@ -1370,7 +2061,9 @@ namespace gum {
      *
      *  The `callback` function should get the incoming node ID and the edge
      *  type; and return `true` to continue the iteration, and `false` to stop
-     *  it.
+     *  it. If the `callback` also accepts a third argument, the edge handle is
+     *  passed too which can be used for accessing edge properties directly
+     *  (e.g. `edge_overlap( handle )`) without looking up the edge again.
      *
      *  @param  id  The node ID whose incoming edges are considered.
      *  @param  callback  The `callback` function.
@@ -1382,14 +2075,36 @@ namespace gum {
     for_each_edges_in( id_type id,
                        TCallback callback ) const
     {
-      static_assert( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type >, "received a non-invocable as callback" );
+      static_assert( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type > ||
+                     std::is_invocable_r_v< bool, TCallback, id_type, linktype_type, edge_handle_type >,
+                     "received a non-invocable as callback" );
 
       if ( !this->has_edges_in( id ) ) return true;
+      if ( this->out_only ) {
+        this->build_in_index();
+        rank_type rank = this->id_to_rank( id );
+        for ( size_type i = this->in_starts[ rank - 1 ]; i < this->in_starts[ rank ]; ++i ) {
+          size_type pos = this->in_edges[ i ];
+          if ( !this->call_edge_callback( callback, this->edge_owner( pos ),
+                                          this->get_adj_linktype( pos ), pos ) )
+            return false;
+        }
+        return true;
+      }
+      if ( this->forward_only ) {
+        return this->for_each_edges_in_pos(
+            id,
+            [this, callback]( size_type pos ) {
+              return this->call_edge_callback( callback, this->get_adj_id( pos ),
+                                               trait_type::get_default_linktype(), pos );
+            }
+          );
+      }
       return this->for_each_edges_in_pos(
           id,
           [this, callback]( size_type pos ) {
-            return callback( this->get_adj_id( pos ),
-                             this->get_adj_linktype( pos ) );
+            return this->call_edge_callback( callback, this->get_adj_id( pos ),
+                                             this->get_adj_linktype( pos ), pos );
           }
         );
     }
@@ -1484,6 +2199,55 @@ namespace gum {
       return this->indegree( side ) > 1;
     }
 
+    /**
+     *  @brief  Build the incoming edges index of an out-only graph.
+     *
+     *  The index maps each node to the positions of the outgoing edge entries
+     *  pointing to it. It is built on the first call to `for_each_edges_in`
+     *  if it has not been built explicitly. It does nothing if the graph stores
+     *  incoming edges or the index has already been built.
+     *
+     *  It is safe to be triggered by concurrent in-edge queries: the index is
+     *  built once under a lock and published by an atomic flag.
+     */
+    inline void
+    build_in_index( ) const
+    {
+      if ( this->has_in_index() ) return;
+      std::lock_guard< std::mutex > lock( this->in_index_mutex );
+      if ( this->in_indexed.load( std::memory_order_acquire ) ) return;
+
+      pos_vector_type starts( this->get_node_count() + 1, 0 );
+      size_type total = 0;
+      this->for_each_node(
+          [this, &starts, &total]( rank_type rank, id_type id ) {
+            starts[ rank - 1 ] = total;
+            total += this->indegree( id );
+            return true;
+          } );
+      starts[ this->get_node_count() ] = total;
+
+      pos_vector_type edges( total, 0 );
+      pos_vector_type next( starts );
+      this->for_each_node(
+          [this, &edges, &next]( rank_type, id_type id ) {
+            this->for_each_edges_out_pos(
+                id,
+                [this, &edges, &next]( size_type pos ) {
+                  rank_type to_rank = this->id_to_rank( this->get_adj_id( pos ) );
+                  edges[ next[ to_rank - 1 ]++ ] = pos;
+                  return true;
+                } );
+            return true;
+          } );
+
+      sdsl::util::bit_compress( starts );
+      sdsl::util::bit_compress( edges );
+      sdsl::util::assign( this->in_starts, std::move( starts ) );
+      sdsl::util::assign( this->in_edges, std::move( edges ) );
+      this->in_indexed.store( true, std::memory_order_release );
+    }
+
     inline void
     clear( )
     {
@@ -1495,6 +2259,7 @@ namespace gum {
       this->ids_bv[ 0 ] = 0;
       sdsl::util::init_support( this->node_rank, &this->ids_bv );
       sdsl::util::init_support( this->node_id, &this->ids_bv );
+      this->clear_in_index();
     }
 
   protected:
@@ -1521,6 +2286,7 @@ namespace gum {
     inline size_type
     edge_core_len( ) const
     {
+      if ( this->forward_only ) return trait_type::EDGE_CORE_LEN - trait_type::ADJ_LINKTYPE_LEN;
       return trait_type::EDGE_CORE_LEN;
     }
 
@@ -1530,21 +2296,39 @@ namespace gum {
       return this->edge_core_len() + this->ep_padding;
     }
 
+    /**
+     *  @brief  Return the number of incoming edge entries stored in a node record.
+     */
+    inline rank_type
+    stored_indegree( id_type id ) const
+    {
+      return this->out_only ? 0 : this->indegree( id );
+    }
+
     inline size_type
     node_entry_len( id_type id ) const
     {
       return this->header_entry_len() +
-          ( this->outdegree( id ) + this->indegree( id ) ) * this->edge_entry_len();
+          ( this->outdegree( id ) + this->stored_indegree( id ) ) * this->edge_entry_len();
     }
 
     inline size_type
     int_vector_len( ) const
     {
       return this->get_node_count() * this->header_entry_len() +
-          2 * this->get_edge_count() * this->edge_entry_len() +
+          ( this->out_only ? 1 : 2 ) * this->get_edge_count() * this->edge_entry_len() +
           1 /* the first dummy entry */;
     }
 
+    /**
+     *  @brief  Return the ID of the node whose record contains the position `pos`.
+     */
+    inline id_type
+    edge_owner( size_type pos ) const
+    {
+      return this->rank_to_id( this->node_rank( pos ) );
+    }
+
     inline size_type
     edges_out_pos( id_type id ) const
     {
@@ -1581,7 +2365,7 @@ namespace gum {
       static_assert( std::is_invocable_r_v< bool, TCallback, size_type >, "received a non-invocable as callback" );
 
       size_type pos = this->edges_in_pos( id );
-      for ( rank_type i = 0; i < this->indegree( id ); ++i ) {
+      for ( rank_type i = 0; i < this->stored_indegree( id ); ++i ) {
         if ( !callback( pos ) ) return false;
         pos += this->edge_entry_len();
       }
@@ -1627,12 +2411,17 @@ namespace gum {
     inline linktype_type
     get_adj_linktype( size_type pos ) const
     {
+      if ( this->forward_only ) return trait_type::get_default_linktype();
       return trait_type::get_adj_linktype( this->nodes, pos );
     }
 
     inline void
     set_adj_linktype( size_type pos, linktype_type value )
     {
+      if ( this->forward_only ) {
+        assert( value == trait_type::get_default_linktype() );
+        return;
+      }
       trait_type::set_adj_linktype( this->nodes, pos, value );
     }
 
@@ -1640,6 +2429,8 @@ namespace gum {
     /* === DATA MEMBERS === */
     padding_type np_padding;
     padding_type ep_padding;
+    bool out_only;
+    bool forward_only;
     rank_type node_count;
     rank_type edge_count;
     nodes_type nodes;
@@ -1647,8 +2438,40 @@ namespace gum {
     rank_map_type node_rank;
     id_map_type node_id;
     coordinate_type coordinate;
+    mutable std::atomic< bool > in_indexed;
+    mutable std::mutex in_index_mutex;  /**< guards the lazy build of the in-edges index */
+    mutable pos_vector_type in_starts;  /**< start of in-edges of each node (by rank) */
+    mutable pos_vector_type in_edges;   /**< positions of out-edge entries (by target) */
 
     /* === METHODS === */
+    inline void
+    clear_in_index( )
+    {
+      this->in_indexed.store( false, std::memory_order_release );
+      sdsl::util::clear( this->in_starts );
+      sdsl::util::clear( this->in_edges );
+    }
+
+    /**
+     *  @brief  Call an edge `callback` with or without the edge handle.
+     *
+     *  The edge handle is passed to the `callback` only if it accepts it as the
+     *  third argument.
+     */
+    template< typename TCallback >
+    static inline bool
+    call_edge_callback( TCallback const& callback, id_type adj_id, linktype_type type,
+                        edge_handle_type handle )
+    {
+      if constexpr ( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type, edge_handle_type > ) {
+        return callback( adj_id, type, handle );
+      }
+      else {
+        (void)handle;  // Silencing unused-parameter warning.
+        return callback( adj_id, type );
+      }
+    }
+
     /**
     *  @brief  Construct the succinct graph from the Dynamic one.
     *
@@ -1666,8 +2489,12 @@ namespace gum {
     inline void
     construct( dynamic_template< TCSpec > const& d_graph )
     {
+      if ( !d_graph.is_compact() )
+        throw std::runtime_error( "constructing from a non-compact Dynamic graph" );
       this->node_count = d_graph.get_node_count();
       this->edge_count = d_graph.get_edge_count();
+      this->forward_only = this->has_default_linktypes_only( d_graph );
+      this->clear_in_index();
       sdsl::util::assign( this->nodes, nodes_type( this->int_vector_len(), 0 ) );
       sdsl::util::assign( this->ids_bv, bv_type( this->int_vector_len(), 0 ) );
       size_type pos = 1;  // Leave the first entry as dummy.
@@ -1692,6 +2519,23 @@ namespace gum {
       this->identificate( );
     }
 
+    /**
+     *  @brief  Check whether all edges of a Dynamic graph are of the default link type.
+     */
+    template< typename TCSpec >
+    static inline bool
+    has_default_linktypes_only( dynamic_template< TCSpec > const& d_graph )
+    {
+      return d_graph.for_each_node(
+          [&d_graph]( rank_type, id_type id ) {
+            return d_graph.for_each_edges_out(
+                id,
+                []( id_type, linktype_type type ) {
+                  return type == trait_type::get_default_linktype();
+                } );
+          } );
+    }
+
     template< typename TCSpec >
     inline void
     fill_edges_entries( dynamic_template< TCSpec > const& d_graph,
@@ -1709,6 +2553,7 @@ namespace gum {
             return true;
           } );
 
+      if ( this->out_only ) return;
       pos = this->edges_in_pos( new_id );
       d_graph.for_each_edges_in(
           d_id,
@@ -1753,177 +2598,1218 @@ namespace gum {
   };  /* --- end of template class DirectedGraph --- */
 
   /**
-   *  @brief  Node property class (dynamic).
+   *  @brief  Bidirected graph class (compressed).
    *
-   *  Represent data associated with each node, mainly node sequences. Each data
-   *  structure associated with each node are stored in a container in node rank
-   *  order.
+   *  Represent the connectivity of a bidirected graph as a compressed byte
+   *  stream. Adjacency lists are delta-encoded relative to the node ID and
+   *  stored as variable-length integers (see `GraphBaseTrait< Compressed >`);
+   *  so that it usually requires a few times less space than the `Succinct`
+   *  representation at the cost of decoding adjacency lists on traversal.
+   *
+   *  NOTE: In contrast with `Succinct` graphs, node IDs in these graphs are
+   *  node ranks. The node records are reached through sampled offsets, so
+   *  accessing the adjacency list of a node requires skipping at most
+   *  `sample_rate - 1` preceding records.
    */
-  template< uint8_t ...TWidths >
-  class NodeProperty< Dynamic, TWidths... > {
+  template< typename TDir, typename TCoordSpec, uint8_t ...TWidths >
+  class DirectedGraph< Compressed, TDir, TCoordSpec, TWidths... > {
   public:
-    /* === TYPEDEFS === */
-    using spec_type = Dynamic;
-    using trait_type = NodePropertyTrait< spec_type, TWidths... >;
+    /* === TYPEDEFS  === */
+    using spec_type = Compressed;
+    using dir_type = TDir;
+    using trait_type = DirectedGraphTrait< spec_type, dir_type, TWidths... >;
     using id_type = typename trait_type::id_type;
     using offset_type = typename trait_type::offset_type;
-    using rank_type = typename trait_type::rank_type;
-    using sequence_type = typename trait_type::sequence_type;
-    using string_type = typename trait_type::string_type;
-    using node_type = typename trait_type::node_type;
     using value_type = typename trait_type::value_type;
-    using container_type = typename trait_type::container_type;
+    using nodes_type = typename trait_type::nodes_type;
     using size_type = typename trait_type::size_type;
-    using const_reference = typename trait_type::const_reference;
-    using const_iterator = typename trait_type::const_iterator;
-    using const_sequence_container_type =
-        typename trait_type::template const_sequence_proxy_container< NodeProperty >;
-    using const_name_container_type =
-        typename trait_type::template const_name_proxy_container< NodeProperty >;
-    using const_sequenceset_type = const_sequence_container_type;
-    using const_stringset_type = const_name_container_type;
-    using seq_const_reference = typename const_sequenceset_type::const_reference;
-    using seq_reference = typename const_sequenceset_type::reference;
-    using succinct_type = NodeProperty< Succinct, TWidths... >;
-    using dynamic_type = NodeProperty;
+    using rank_type = typename trait_type::rank_type;
+    using samples_type = typename trait_type::samples_type;
+    using ids_type = typename trait_type::ids_type;
+    using code_type = typename trait_type::code_type;
+    using string_type = typename trait_type::string_type;
+    using side_type = typename trait_type::side_type;
+    using link_type = typename trait_type::link_type;
+    using linktype_type = typename trait_type::linktype_type;
+    using adjs_type = typename trait_type::adjs_type;
+    using edge_handle_type = size_type;
+    using coordspec_type = std::conditional_t< std::is_same< TCoordSpec, void >::value,
+                                               coordinate::Dense, TCoordSpec >;
+    using coordinate_type = CoordinateType< DirectedGraph, coordspec_type >;
 
-    /* === LIFECYCLE === */
-    /* constructor */
-    NodeProperty( )
-      : sequences_len_sum( 0 ), names_len_sum( 0 )
-    { }
+    template< typename TCSpec = void >
+    using dynamic_template = DirectedGraph< Dynamic, dir_type, TCSpec, TWidths... >;
 
-    NodeProperty( NodeProperty const& other ) = default;      /* copy constructor */
-    NodeProperty( NodeProperty&& other ) noexcept = default;  /* move constructor */
-    ~NodeProperty() noexcept = default;                       /* destructor       */
+    template< typename TCSpec = void >
+    using succinct_template = DirectedGraph< Succinct, dir_type, TCSpec, TWidths... >;
 
-    /* === ACCESSORS === */
-    inline container_type const&
-    get_nodes( ) const
+    template< typename TCSpec = coordspec_type >
+    using compressed_template = DirectedGraph< Compressed, dir_type, TCSpec, TWidths... >;
+
+    using dynamic_type = dynamic_template<>;
+    using succinct_type = succinct_template<>;
+    using compressed_type = compressed_template<>;
+
+    /* === LIFECYCLE  === */
+    DirectedGraph( rank_type srate = trait_type::DEFAULT_SAMPLE_RATE )
+      : sample_rate( srate ),
+        node_count( 0 ),
+        edge_count( 0 ),
+        ids( ids_type( 1, 0 ) )
     {
-      return this->nodes;
+      assert( srate != 0 );
     }
 
-    inline typename sequence_type::size_type
-    get_sequences_len_sum( ) const
+    template< typename TCSpec >
+    DirectedGraph( dynamic_template< TCSpec > const& d_graph,
+                   rank_type srate = trait_type::DEFAULT_SAMPLE_RATE )
+      : sample_rate( srate )
     {
-      return this->sequences_len_sum;
+      assert( srate != 0 );
+      this->construct( d_graph );
     }
 
-    inline typename string_type::size_type
-    get_names_len_sum( ) const
+    template< typename TCSpec >
+    DirectedGraph( succinct_template< TCSpec > const& s_graph,
+                   rank_type srate = trait_type::DEFAULT_SAMPLE_RATE )
+      : sample_rate( srate )
     {
-      return this->names_len_sum;
+      assert( srate != 0 );
+      this->construct( s_graph );
     }
 
-    /* === OPERATORS === */
-    NodeProperty& operator=( NodeProperty const& other ) = default;      /* copy assignment operator */
-    NodeProperty& operator=( NodeProperty&& other ) noexcept = default;  /* move assignment operator */
+    DirectedGraph( DirectedGraph const& other ) = default;      /* copy constructor */
+    DirectedGraph( DirectedGraph&& other ) noexcept = default;  /* move constructor */
+    ~DirectedGraph() noexcept = default;                        /* destructor       */
 
-    inline const_reference
-    operator[]( size_type i ) const
+    /* === ACCESSORS === */
+    inline nodes_type const&
+    get_nodes( ) const
     {
-      return this->nodes[ i ];
+      return this->nodes;
     }
 
-    inline const_reference
-    operator()( rank_type rank ) const
+    inline rank_type
+    get_sample_rate( ) const
     {
-      return ( *this )[ rank - 1 ];
+      return this->sample_rate;
     }
 
-    /* === METHODS === */
-    inline const_reference
-    at( size_type i ) const
+    inline rank_type
+    get_node_count( ) const
     {
-      return this->nodes.at( i );
+      return this->node_count;
     }
 
-    inline const_iterator
-    begin( ) const
+    /**
+     *  @brief  Return the maximum node rank; i.e. the node count.
+     */
+    inline rank_type
+    get_max_rank( ) const
     {
-      return this->nodes.begin();
+      return this->node_count;
     }
 
-    inline const_iterator
-    end( ) const
+    inline rank_type
+    get_edge_count( ) const
     {
-      return this->nodes.end();
+      return this->edge_count;
     }
 
-    inline const_reference
-    back( ) const
+    inline coordinate_type const&
+    get_coordinate( ) const
     {
-      return this->nodes.back();
+      return this->coordinate;
     }
 
-    inline const_reference
-    front( ) const
+    /**
+     *  @brief  Return the size of the graph connectivity in bytes.
+     *
+     *  It counts the byte stream of node records, the sampled record offsets,
+     *  and the embedded IDs of the nodes. The embedded coordinate system is not
+     *  counted.
+     */
+    inline std::size_t
+    size_in_bytes( ) const
     {
-      return this->nodes.front();
+      return sdsl::size_in_bytes( this->nodes )
+          + sdsl::size_in_bytes( this->samples )
+          + sdsl::size_in_bytes( this->ids );
     }
 
-    inline size_type
-    size( ) const
+    /* === OPERATORS === */
+    DirectedGraph& operator=( DirectedGraph const& other ) = default;      /* copy assignment operator */
+    DirectedGraph& operator=( DirectedGraph&& other ) noexcept = default;  /* move assignment operator */
+
+    template< typename TCSpec >
+    DirectedGraph&
+    operator=( dynamic_template< TCSpec > const& d_graph )
     {
-      return this->nodes.size();
+      this->construct( d_graph );
+      return *this;
     }
 
-    inline void
-    add_node( value_type node )
+    template< typename TCSpec >
+    DirectedGraph&
+    operator=( succinct_template< TCSpec > const& s_graph )
     {
-      this->sequences_len_sum += node.sequence.size();
-      this->names_len_sum += node.name.size();
-      this->nodes.push_back( std::move( node ) );
+      this->construct( s_graph );
+      return *this;
     }
 
-    inline void
-    update_node( rank_type rank, value_type node )
+    /* === METHODS === */
+    /**
+     *  @brief  Return the rank of a node by its ID.
+     *
+     *  Node IDs are node ranks in `Compressed` graphs.
+     *
+     *  @param  id A node ID.
+     *  @return The corresponding node rank.
+     */
+    constexpr inline rank_type
+    id_to_rank( id_type id ) const
     {
-      value_type& old = this->nodes[ rank - 1 ];
-      this->sequences_len_sum += node.sequence.size() - old.sequence.size();
-      this->names_len_sum += node.name.size() - old.name.size();
-      old = std::move( node );
+      assert( this->has_node( id ) );
+      return id;
     }
 
-    template< typename TContainer >
-    inline void
-    sort_nodes( TContainer const& perm )
+    /**
+     *  @brief  Return the ID of a node by its rank.
+     *
+     *  Node IDs are node ranks in `Compressed` graphs.
+     *
+     *  @param  rank A node rank.
+     *  @return The corresponding node ID.
+     */
+    constexpr inline id_type
+    rank_to_id( rank_type rank ) const
+    {
+      assert( 0 < rank && rank <= this->node_count );
+      return rank;
+    }
+
+    /**
+     *  @brief  Return the embedded coordinate ID of a node by its internal ID.
+     *
+     *  NOTE: This function assumes that node ID exists in the graph, otherwise
+     *  the behaviour is undefined. The node ID can be verified by `has_node`
+     *  method before calling this one.
+     *
+     *  @param  id A node ID.
+     *  @return The corresponding node embedded coordinate ID.
+     */
+    inline id_type
+    coordinate_id( id_type id ) const
+    {
+      assert( this->has_node( id ) );
+      return this->ids[ id ];
+    }
+
+    /**
+     *  @brief  Return the internal ID of a node by its external coordinate ID.
+     *
+     *  @param  ext_id node ID in the coordinate system.
+     *  @return The corresponding node ID in the graph.
+     */
+    inline id_type
+    id_by_coordinate( typename coordinate_type::lid_type const& ext_id ) const
+    {
+      return this->coordinate( ext_id );
+    }
+
+    /**
+     *  @brief  Return the ID of the successor node in rank.
+     *
+     *  @param  id A node id.
+     *  @return The node ID of the successor node of a node whose ID is `id` in the rank.
+     */
+    inline id_type
+    successor_id( id_type id ) const
+    {
+      assert( this->has_node( id ) );
+      return static_cast< rank_type >( id ) < this->node_count ? id + 1 : 0;
+    }
+
+    inline bool
+    has_node( id_type id ) const
+    {
+      return 0 < id && static_cast< rank_type >( id ) <= this->node_count;
+    }
+
+    inline bool
+    has_node( side_type side ) const
+    {
+      return this->has_node( this->id_of( side ) );
+    }
+
+    /**
+     *  @brief  Call a callback on each nodes in rank order.
+     *
+     *  @param  callback The callback function.
+     *  @return `true` if it has iterated over all nodes, and `false` if the
+     *  iteration has been interrupted by `callback`.
+     */
+    template < typename TCallback >
+    inline bool
+    for_each_node( TCallback callback,
+                   rank_type s_rank=1 ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, rank_type, id_type >, "received a non-invocable as callback" );
+
+      for ( rank_type rank = s_rank; rank <= this->node_count; ++rank ) {
+        if ( !callback( rank, static_cast< id_type >( rank ) ) ) return false;
+      }
+      return true;
+    }
+
+    constexpr inline id_type
+    from_id( link_type sides ) const
+    {
+      return trait_type::from_id( sides );
+    }
+
+    constexpr inline id_type
+    to_id( link_type sides ) const
+    {
+      return trait_type::to_id( sides );
+    }
+
+    constexpr inline id_type
+    id_of( side_type side ) const
+    {
+      return trait_type::id_of( side );
+    }
+
+    constexpr inline side_type
+    from_side( link_type sides ) const
+    {
+      return trait_type::from_side( sides );
+    }
+
+    constexpr inline side_type
+    from_side( id_type id, linktype_type type=trait_type::get_default_linktype() ) const
+    {
+      return trait_type::from_side( id, type );
+    }
+
+    constexpr inline side_type
+    to_side( link_type sides ) const
+    {
+      return trait_type::to_side( sides );
+    }
+
+    constexpr inline side_type
+    to_side( id_type id, linktype_type type=trait_type::get_default_linktype() ) const
+    {
+      return trait_type::to_side( id, type );
+    }
+
+    constexpr inline side_type
+    start_side( id_type id ) const
+    {
+      return trait_type::start_side( id );
+    }
+
+    constexpr inline side_type
+    end_side( id_type id ) const
+    {
+      return trait_type::end_side( id );
+    }
+
+    constexpr inline side_type
+    opposite_side( side_type side ) const
+    {
+      return trait_type::opposite_side( side );
+    }
+
+    template< typename TCallback >
+    inline bool
+    for_each_side( id_type id, TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, side_type >, "received a non-invocable as callback" );
+
+      return trait_type::for_each_side( id, callback );
+    }
+
+    constexpr inline link_type
+    make_link( side_type from, side_type to ) const
+    {
+      return trait_type::make_link( from, to );
+    }
+
+    constexpr inline link_type
+    make_link( id_type from, id_type to,
+               linktype_type type=trait_type::get_default_linktype() ) const
+    {
+      return trait_type::make_link( from, to, type );
+    }
+
+    constexpr inline linktype_type
+    get_default_linktype( ) const
+    {
+      return trait_type::get_default_linktype();
+    }
+
+    constexpr inline linktype_type
+    linktype( side_type from, side_type to ) const
+    {
+      return trait_type::linktype( from, to );
+    }
+
+    constexpr inline linktype_type
+    linktype( link_type sides ) const
+    {
+      return trait_type::linktype( sides );
+    }
+
+    constexpr inline bool
+    is_from_start( link_type sides ) const
+    {
+      return trait_type::is_from_start( sides );
+    }
+
+    constexpr inline bool
+    is_from_start( linktype_type type ) const
+    {
+      return trait_type::is_from_start( type );
+    }
+
+    constexpr inline bool
+    is_to_end( link_type sides ) const
+    {
+      return trait_type::is_to_end( sides );
+    }
+
+    constexpr inline bool
+    is_to_end( linktype_type type ) const
+    {
+      return trait_type::is_to_end( type );
+    }
+
+    constexpr inline bool
+    is_valid( linktype_type type ) const
+    {
+      return trait_type::is_valid( type );
+    }
+
+    constexpr inline bool
+    is_valid_from( side_type from, linktype_type type ) const
+    {
+      return trait_type::is_valid_from( from, type );
+    }
+
+    constexpr inline bool
+    is_valid_to( side_type to, linktype_type type ) const
+    {
+      return trait_type::is_valid_to( to, type );
+    }
+
+    inline bool
+    has_edge( id_type from, id_type to, linktype_type type=trait_type::get_default_linktype() ) const
+    {
+      if ( !this->has_node( from ) || !this->has_node( to ) ) return false;
+      auto fod = this->outdegree( from );
+      auto tod = this->indegree( to );
+      auto findto =
+          [to, type]( id_type tid, linktype_type ttype ) {
+            if ( tid == to && ttype == type ) return false;
+            return true;
+          };
+      auto findfrom =
+          [from, type]( id_type fid, linktype_type ftype ) {
+            if ( fid == from && ftype == type ) return false;
+            return true;
+          };
+      if ( fod < tod ) return !this->for_each_edges_out( from, findto );
+      else return !this->for_each_edges_in( to, findfrom );
+    }
+
+    inline bool
+    has_edge( side_type from, side_type to ) const
+    {
+      return this->has_edge( this->id_of( from ), this->id_of( to ),
+                             this->linktype( from, to ) );
+    }
+
+    inline bool
+    has_edge( link_type sides ) const
+    {
+      return this->has_edge( this->from_id( sides ), this->to_id( sides ),
+                             this->linktype( sides ) );
+    }
+
+    inline adjs_type
+    adjacents_out( side_type from ) const
+    {
+      adjs_type adjs;
+      this->for_each_edges_out(
+          from,
+          [&adjs]( side_type to ) {
+            adjs.push_back( to );
+            return true;
+          } );
+      return adjs;
+    }
+
+    inline adjs_type
+    adjacents_in( side_type to ) const
+    {
+      adjs_type adjs;
+      this->for_each_edges_in(
+          to,
+          [&adjs]( side_type from ) {
+            adjs.push_back( from );
+            return true;
+          } );
+      return adjs;
+    }
+
+    /**
+     *  @brief  Call a `callback` on each outgoing edges from `from` side.
+     *
+     *  The `callback` function should get the outgoing side and return `true`
+     *  to continue the iteration, and `false` to stop it.
+     *
+     *  @param  from  The side whose outgoing edges are considered.
+     *  @param  callback  The `callback` function.
+     *  @return `true` if it has iterated over all edges, and `false` if the
+     *  iteration has been interrupted by `callback`.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_edges_out( side_type from,
+                        TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, side_type >, "received a non-invocable as callback" );
+
+      return this->for_each_edges_out(
+          this->id_of( from ),
+          [this, from, callback]( id_type id, linktype_type type ) {
+            if ( !this->is_valid_from( from, type ) ) return true;
+            if ( !callback( this->to_side( id, type ) ) ) return false;
+            return true;
+          }
+        );
+    }
+
+    /**
+     *  @brief  Call a `callback` on each outgoing edges from each side of a node.
+     *
+     *  The `callback` function should get the outgoing node ID and the edge
+     *  type; and return `true` to continue the iteration, and `false` to stop
+     *  it. If the `callback` also accepts a third argument, the edge handle
+     *  (i.e. the position of the edge entry in the byte stream) is passed too.
+     *
+     *  @param  id  The node ID whose outgoing edges are considered.
+     *  @param  callback  The `callback` function.
+     *  @return `true` if it has iterated over all edges, and `false` if the
+     *  iteration has been interrupted by `callback`.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_edges_out( id_type id,
+                        TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type > ||
+                     std::is_invocable_r_v< bool, TCallback, id_type, linktype_type, edge_handle_type >,
+                     "received a non-invocable as callback" );
+
+      assert( this->has_node( id ) );
+      size_type pos = this->node_pos( id );
+      rank_type outdeg = trait_type::get_varint( this->nodes, pos );
+      trait_type::skip_varints( this->nodes, pos, 1 );  // indegree
+      return this->for_each_edges_at( id, pos, outdeg, callback );
+    }
+
+    /**
+     *  @brief  Call a `callback` on each incoming edges to `to` side.
+     *
+     *  The `callback` function should get the incoming side and return `true`
+     *  to continue the iteration, and `false` to stop it.
+     *
+     *  @param  to  The side whose incoming edges are considered.
+     *  @param  callback  The `callback` function.
+     *  @return `true` if it has iterated over all edges, and `false` if the
+     *  iteration has been interrupted by `callback`.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_edges_in( side_type to,
+                       TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, side_type >, "received a non-invocable as callback" );
+
+      return this->for_each_edges_in(
+          this->id_of( to ),
+          [this, to, callback]( id_type id, linktype_type type ) {
+            if ( !this->is_valid_to( to, type ) ) return true;
+            if ( !callback( this->from_side( id, type ) ) ) return false;
+            return true;
+          }
+        );
+    }
+
+    /**
+     *  @brief  Call a `callback` on each incoming edges to each side of a node.
+     *
+     *  The `callback` function should get the incoming node ID and the edge
+     *  type; and return `true` to continue the iteration, and `false` to stop
+     *  it. If the `callback` also accepts a third argument, the edge handle
+     *  (i.e. the position of the edge entry in the byte stream) is passed too.
+     *
+     *  @param  id  The node ID whose incoming edges are considered.
+     *  @param  callback  The `callback` function.
+     *  @return `true` if it has iterated over all edges, and `false` if the
+     *  iteration has been interrupted by `callback`.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_edges_in( id_type id,
+                       TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type > ||
+                     std::is_invocable_r_v< bool, TCallback, id_type, linktype_type, edge_handle_type >,
+                     "received a non-invocable as callback" );
+
+      assert( this->has_node( id ) );
+      size_type pos = this->node_pos( id );
+      rank_type outdeg = trait_type::get_varint( this->nodes, pos );
+      rank_type indeg = trait_type::get_varint( this->nodes, pos );
+      trait_type::skip_varints( this->nodes, pos, outdeg );
+      return this->for_each_edges_at( id, pos, indeg, callback );
+    }
+
+    inline rank_type
+    outdegree( id_type id ) const
+    {
+      assert( this->has_node( id ) );
+      size_type pos = this->node_pos( id );
+      return trait_type::get_varint( this->nodes, pos );
+    }
+
+    inline rank_type
+    outdegree( side_type side ) const
+    {
+      rank_type retval = 0;
+      this->for_each_edges_out(
+          side,
+          [&retval]( side_type ) {
+            ++retval;
+            return true;
+          }
+        );
+      return retval;
+    }
+
+    inline rank_type
+    indegree( id_type id ) const
+    {
+      assert( this->has_node( id ) );
+      size_type pos = this->node_pos( id );
+      trait_type::skip_varints( this->nodes, pos, 1 );  // outdegree
+      return trait_type::get_varint( this->nodes, pos );
+    }
+
+    inline rank_type
+    indegree( side_type side ) const
+    {
+      rank_type retval = 0;
+      this->for_each_edges_in(
+          side,
+          [&retval]( side_type ) {
+            ++retval;
+            return true;
+          }
+        );
+      return retval;
+    }
+
+    inline bool
+    has_edges_in( side_type side ) const
+    {
+      return this->indegree( side ) != 0;
+    }
+
+    inline bool
+    has_edges_in( id_type id ) const
+    {
+      return this->indegree( id ) != 0;
+    }
+
+    inline bool
+    has_edges_out( side_type side ) const
+    {
+      return this->outdegree( side ) != 0;
+    }
+
+    inline bool
+    has_edges_out( id_type id ) const
+    {
+      return this->outdegree( id ) != 0;
+    }
+
+    inline bool
+    is_branch( id_type id ) const
+    {
+      return this->outdegree( id ) > 1;
+    }
+
+    inline bool
+    is_branch( side_type side ) const
+    {
+      return this->outdegree( side ) > 1;
+    }
+
+    inline bool
+    is_merge( id_type id ) const
+    {
+      return this->indegree( id ) > 1;
+    }
+
+    inline bool
+    is_merge( side_type side ) const
+    {
+      return this->indegree( side ) > 1;
+    }
+
+    inline void
+    clear( )
+    {
+      this->node_count = 0;
+      this->edge_count = 0;
+      sdsl::util::clear( this->nodes );
+      sdsl::util::clear( this->samples );
+      sdsl::util::assign( this->ids, ids_type( 1, 0 ) );
+      this->coordinate = coordinate_type();
+    }
+
+  protected:
+    /* === ACCESSORS === */
+    inline coordinate_type&
+    get_coordinate( )
+    {
+      return this->coordinate;
+    }
+
+    /* === METHODS === */
+    /**
+     *  @brief  Return the position of the record of a node in the byte stream.
+     *
+     *  It starts from the closest sampled offset and skips the preceding records.
+     */
+    inline size_type
+    node_pos( id_type id ) const
+    {
+      rank_type idx = id - 1;
+      size_type pos = this->samples[ idx / this->sample_rate ];
+      for ( rank_type i = idx % this->sample_rate; i != 0; --i ) {
+        rank_type outdeg = trait_type::get_varint( this->nodes, pos );
+        rank_type indeg = trait_type::get_varint( this->nodes, pos );
+        trait_type::skip_varints( this->nodes, pos, outdeg + indeg );
+      }
+      return pos;
+    }
+
+    template< typename TCallback >
+    inline bool
+    for_each_edges_at( id_type id, size_type pos, rank_type count,
+                       TCallback const& callback ) const
+    {
+      for ( ; count != 0; --count ) {
+        size_type handle = pos;
+        code_type code = trait_type::get_varint( this->nodes, pos );
+        if ( !this->call_edge_callback( callback, trait_type::decode_adj_id( id, code ),
+                                        trait_type::decode_adj_linktype( code ), handle ) ) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+  private:
+    /* === DATA MEMBERS === */
+    rank_type sample_rate;
+    rank_type node_count;
+    rank_type edge_count;
+    nodes_type nodes;
+    samples_type samples;
+    ids_type ids;
+    coordinate_type coordinate;
+
+    /* === METHODS === */
+    /**
+     *  @brief  Call an edge `callback` with or without the edge handle.
+     *
+     *  The edge handle is passed to the `callback` only if it accepts it as the
+     *  third argument.
+     */
+    template< typename TCallback >
+    static inline bool
+    call_edge_callback( TCallback const& callback, id_type adj_id, linktype_type type,
+                        edge_handle_type handle )
+    {
+      if constexpr ( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type, edge_handle_type > ) {
+        return callback( adj_id, type, handle );
+      }
+      else {
+        (void)handle;  // Silencing unused-parameter warning.
+        return callback( adj_id, type );
+      }
+    }
+
+    /**
+     *  @brief  Construct the compressed graph from a `Dynamic` or `Succinct` one.
+     *
+     *  Node records are encoded in rank order; so node IDs of the compressed
+     *  graph are the node ranks in the input graph. The node IDs of the input
+     *  graph (or its embedded coordinate IDs, if any) are kept as the embedded
+     *  coordinate system.
+     *
+     *  @param  other A `Dynamic` or `Succinct` graph.
+     */
+    template< typename TGraph >
+    inline void
+    construct( TGraph const& other )
+    {
+      if constexpr ( std::is_same< typename TGraph::spec_type, Dynamic >::value ) {
+        if ( !other.is_compact() )
+          throw std::runtime_error( "constructing from a non-compact Dynamic graph" );
+      }
+      this->node_count = other.get_node_count();
+      this->edge_count = other.get_edge_count();
+      this->coordinate = coordinate_type();
+
+      std::vector< uint8_t > bytes;
+      std::vector< size_type > offsets;
+      // Two bytes per each node header and edge entry is a rough estimation.
+      bytes.reserve( 2 * ( this->node_count + 2 * this->edge_count ) );
+      offsets.reserve( this->node_count / this->sample_rate + 1 );
+      sdsl::util::assign( this->ids, ids_type( this->node_count + 1, 0 ) );
+
+      auto put_edge =
+          [&other, &bytes]( id_type id, id_type adj, linktype_type type ) {
+            trait_type::put_varint(
+                bytes, trait_type::encode_adj( id, other.id_to_rank( adj ), type ) );
+            return true;
+          };
+
+      other.for_each_node(
+          [&]( rank_type rank, id_type o_id ) {
+            id_type id = static_cast< id_type >( rank );
+            if ( ( rank - 1 ) % this->sample_rate == 0 ) offsets.push_back( bytes.size() );
+            // Embed the coordinate system of the input graph.
+            id_type ext_id = other.coordinate_id( o_id );
+            this->ids[ id ] = ext_id;
+            this->coordinate( ext_id, id );
+            trait_type::put_varint( bytes, other.outdegree( o_id ) );
+            trait_type::put_varint( bytes, other.indegree( o_id ) );
+            other.for_each_edges_out(
+                o_id,
+                [&put_edge, id]( id_type to, linktype_type type ) {
+                  return put_edge( id, to, type );
+                } );
+            other.for_each_edges_in(
+                o_id,
+                [&put_edge, id]( id_type from, linktype_type type ) {
+                  return put_edge( id, from, type );
+                } );
+            return true;
+          } );
+
+      sdsl::util::assign( this->nodes, nodes_type( bytes.size(), 0 ) );
+      std::copy( bytes.begin(), bytes.end(), this->nodes.begin() );
+      sdsl::util::assign( this->samples, samples_type( offsets.size(), 0 ) );
+      std::copy( offsets.begin(), offsets.end(), this->samples.begin() );
+      sdsl::util::bit_compress( this->samples );
+      sdsl::util::bit_compress( this->ids );
+    }
+  };  /* --- end of template class DirectedGraph --- */
+
+  /**
+   *  @brief  Node property class (dynamic).
+   *
+   *  Represent data associated with each node, mainly node sequences. Node
+   *  sequences and names are stored back to back in a chunked append-only
+   *  character arena; and a small record locating them is kept per node in
+   *  node rank order. Chunks are never reallocated, so appending nodes does not
+   *  move the existing sequences. Updating a node writes the new sequence to
+   *  fresh space; the stale bytes are reclaimed when the arena is repacked by
+   *  `compact` or `shrink_to_fit`.
+   *
+   *  Nodes are accessed by value as `Node` objects viewing the arena.
+   */
+  template< uint8_t ...TWidths >
+  class NodeProperty< Dynamic, TWidths... > {
+  public:
+    /* === TYPEDEFS === */
+    using spec_type = Dynamic;
+    using trait_type = NodePropertyTrait< spec_type, TWidths... >;
+    using id_type = typename trait_type::id_type;
+    using offset_type = typename trait_type::offset_type;
+    using rank_type = typename trait_type::rank_type;
+    using sequence_type = typename trait_type::sequence_type;
+    using string_type = typename trait_type::string_type;
+    using node_type = typename trait_type::node_type;
+    using value_type = typename trait_type::value_type;
+    using record_type = typename trait_type::record_type;
+    using records_type = typename trait_type::records_type;
+    using chunk_type = typename trait_type::chunk_type;
+    using chunks_type = typename trait_type::chunks_type;
+    using container_type = NodeProperty;
+    using size_type = typename trait_type::size_type;
+    using difference_type = typename trait_type::difference_type;
+    using const_reference = typename trait_type::const_reference;
+    using reference = const_reference;
+    using const_iterator = RandomAccessConstIterator< container_type >;
+    using const_sequence_container_type =
+        typename trait_type::template const_sequence_proxy_container< NodeProperty >;
+    using const_name_container_type =
+        typename trait_type::template const_name_proxy_container< NodeProperty >;
+    using const_sequenceset_type = const_sequence_container_type;
+    using const_stringset_type = const_name_container_type;
+    using seq_const_reference = typename trait_type::seq_const_reference;
+    using seq_reference = seq_const_reference;
+    using succinct_type = NodeProperty< Succinct, TWidths... >;
+    using dynamic_type = NodeProperty;
+
+    /* === LIFECYCLE === */
+    /* constructor */
+    NodeProperty( )
+      : sequences_len_sum( 0 ), names_len_sum( 0 ), stale_len( 0 )
+    { }
+
+    NodeProperty( succinct_type const& other )
+      : NodeProperty( )
+    {
+      this->construct( other );
+    }
+
+    NodeProperty( NodeProperty const& other ) = default;      /* copy constructor */
+    NodeProperty( NodeProperty&& other ) noexcept = default;  /* move constructor */
+    ~NodeProperty() noexcept = default;                       /* destructor       */
+
+    /* === ACCESSORS === */
+    inline container_type const&
+    get_nodes( ) const
+    {
+      return *this;
+    }
+
+    inline typename sequence_type::size_type
+    get_sequences_len_sum( ) const
+    {
+      return this->sequences_len_sum;
+    }
+
+    inline typename string_type::size_type
+    get_names_len_sum( ) const
+    {
+      return this->names_len_sum;
+    }
+
+    /* === OPERATORS === */
+    NodeProperty& operator=( NodeProperty const& other ) = default;      /* copy assignment operator */
+    NodeProperty& operator=( NodeProperty&& other ) noexcept = default;  /* move assignment operator */
+
+    inline NodeProperty&
+    operator=( succinct_type const& other )
+    {
+      this->construct( other );
+      return *this;
+    }
+
+    inline const_reference
+    operator[]( size_type i ) const
+    {
+      record_type const& rec = this->records[ this->index_of( i ) ];
+      char const* seq = this->chunks[ rec.chunk ].data() + rec.offset;
+      return const_reference( { seq, rec.seq_len }, { seq + rec.seq_len, rec.name_len } );
+    }
+
+    inline const_reference
+    operator()( rank_type rank ) const
+    {
+      return ( *this )[ rank - 1 ];
+    }
+
+    /* === METHODS === */
+    inline const_reference
+    at( size_type i ) const
+    {
+      if ( i >= this->size() ) throw std::out_of_range( "node property index out of range" );
+      return ( *this )[ i ];
+    }
+
+    inline const_iterator
+    begin( ) const
+    {
+      return const_iterator( this, 0 );
+    }
+
+    inline const_iterator
+    end( ) const
+    {
+      return const_iterator( this, this->size() );
+    }
+
+    inline const_reference
+    back( ) const
+    {
+      return ( *this )[ this->size() - 1 ];
+    }
+
+    inline const_reference
+    front( ) const
+    {
+      return ( *this )[ 0 ];
+    }
+
+    inline size_type
+    size( ) const
+    {
+      return this->records.size();
+    }
+
+    inline void
+    add_node( value_type const& node )
+    {
+      if ( !this->order.empty() ) this->order.push_back( this->records.size() );
+      this->records.push_back( this->put( node.sequence, node.name ) );
+      this->sequences_len_sum += node.sequence.size();
+      this->names_len_sum += node.name.size();
+    }
+
+    inline void
+    reserve( size_type size )
+    {
+      this->records.reserve( size );
+    }
+
+    inline void
+    update_node( rank_type rank, value_type const& node )
+    {
+      record_type& old = this->records[ this->index_of( rank - 1 ) ];
+      this->sequences_len_sum += node.sequence.size() - old.seq_len;
+      this->names_len_sum += node.name.size() - old.name_len;
+      this->stale_len += old.seq_len + old.name_len;
+      old = this->put( node.sequence, node.name );
+    }
+
+    template< typename TContainer >
+    inline void
+    sort_nodes( TContainer const& perm )
+    {
+      this->sort_nodes( perm, Lazy{} );
+      this->apply_order();
+    }
+
+    /**
+     *  @brief  Reorder node ranks by `perm` without moving the records.
+     *
+     *  See `DirectedGraph< Dynamic >::sort_nodes( perm, Lazy )`.
+     */
+    template< typename TContainer >
+    inline void
+    sort_nodes( TContainer const& perm, Lazy )
+    {
+      assert( perm.size() == this->records.size() );
+
+      std::vector< size_type > new_order( perm.size() );
+      #pragma omp parallel for schedule( static )
+      for ( size_type i = 0; i < new_order.size(); ++i ) {
+        new_order[ i ] = this->index_of( perm[ i ] );
+      }
+      this->order = std::move( new_order );
+    }
+
+    /**
+     *  @brief  Move node records to their rank order set by a lazy `sort_nodes`, if any.
+     */
+    inline void
+    apply_order( )
+    {
+      if ( this->order.empty() ) return;
+      util::permute_parallel( this->order, this->records );
+      this->order.clear();
+      this->order.shrink_to_fit();
+    }
+
+    /**
+     *  @brief  Drop the properties of nodes whose rank satisfies `removed`.
+     *
+     *  The relative order of the remaining nodes is preserved. The arena is
+     *  repacked afterwards.
+     */
+    template< typename TPredicate >
+    inline void
+    compact( TPredicate removed )
+    {
+      static_assert( std::is_invocable_r_v< bool, TPredicate, rank_type >, "received a non-invocable as predicate" );
+
+      this->apply_order();
+      size_type last = 0;
+      for ( size_type i = 0; i < this->records.size(); ++i ) {
+        record_type const& rec = this->records[ i ];
+        if ( removed( i + 1 ) ) {
+          this->sequences_len_sum -= rec.seq_len;
+          this->names_len_sum -= rec.name_len;
+          this->stale_len += rec.seq_len + rec.name_len;
+          continue;
+        }
+        this->records[ last++ ] = rec;
+      }
+      this->records.resize( last );
+      this->repack();
+    }
+
+    inline const_sequenceset_type
+    sequences( ) const
+    {
+      return const_sequenceset_type( this, this );
+    }
+
+    inline const_stringset_type
+    names( ) const
+    {
+      return const_stringset_type( this, this );
+    }
+
+    inline void
+    clear( )
+    {
+      this->records.clear();
+      this->order.clear();
+      this->chunks.clear();
+      this->sequences_len_sum = 0;
+      this->names_len_sum = 0;
+      this->stale_len = 0;
+    }
+
+    /**
+     *  @brief  Release unused memory.
+     *
+     *  The arena is repacked if it has any stale bytes left by updated nodes.
+     */
+    inline void
+    shrink_to_fit( )
+    {
+      if ( this->stale_len != 0 ) this->repack();
+      this->records.shrink_to_fit();
+    }
+
+  private:
+    /* === DATA MEMBERS === */
+    records_type records;
+    std::vector< size_type > order;  /**< @brief Index of records by rank set by a lazy `sort_nodes` */
+    chunks_type chunks;
+    typename sequence_type::size_type sequences_len_sum;
+    typename string_type::size_type names_len_sum;
+    std::size_t stale_len;  /**< @brief Total length of unreferenced bytes in the arena */
+
+    /* === METHODS === */
+    inline size_type
+    index_of( size_type i ) const
     {
-      util::permute( perm, this->nodes );
+      return this->order.empty() ? i : this->order[ i ];
     }
 
-    inline const_sequenceset_type
-    sequences( ) const
+    /**
+     *  @brief  Reserve `len` bytes at the end of the arena and return their record.
+     *
+     *  A new chunk is started when the last one cannot fit `len` more bytes
+     *  without reallocation. Chunks larger than `trait_type::CHUNK_CAPACITY` are
+     *  only allocated for longer strings.
+     */
+    static inline record_type
+    allocate( chunks_type& chunks, std::size_t len )
     {
-      return const_sequenceset_type( this, &( this->nodes ) );
+      assert( len <= std::numeric_limits< uint32_t >::max() );
+      if ( chunks.empty() || chunks.back().capacity() - chunks.back().size() < len ) {
+        chunks.emplace_back();
+        chunks.back().reserve( std::max( trait_type::CHUNK_CAPACITY, len ) );
+      }
+      record_type rec;
+      rec.chunk = chunks.size() - 1;
+      rec.offset = chunks.back().size();
+      chunks.back().resize( chunks.back().size() + len );
+      return rec;
     }
 
-    inline const_stringset_type
-    names( ) const
+    template< typename TSequence, typename TString >
+    inline record_type
+    put( TSequence const& seq, TString const& name )
     {
-      return const_stringset_type( this, &( this->nodes ) );
+      record_type rec = NodeProperty::allocate( this->chunks, seq.size() + name.size() );
+      rec.seq_len = seq.size();
+      rec.name_len = name.size();
+      char* dst = this->chunks[ rec.chunk ].data() + rec.offset;
+      std::copy( name.begin(), name.end(), std::copy( seq.begin(), seq.end(), dst ) );
+      return rec;
     }
 
+    /**
+     *  @brief  Rebuild the arena with the node records in their storage order.
+     */
     inline void
-    clear( )
-    {
-      this->nodes.clear();
-      this->sequences_len_sum = 0;
-      this->names_len_sum = 0;
+    repack( )
+    {
+      chunks_type packed;
+      for ( record_type& rec : this->records ) {
+        std::size_t len = rec.seq_len + rec.name_len;
+        char const* src = this->chunks[ rec.chunk ].data() + rec.offset;
+        record_type new_rec = NodeProperty::allocate( packed, len );
+        std::copy( src, src + len, packed[ new_rec.chunk ].data() + new_rec.offset );
+        new_rec.seq_len = rec.seq_len;
+        new_rec.name_len = rec.name_len;
+        rec = new_rec;
+      }
+      this->chunks = std::move( packed );
+      this->stale_len = 0;
     }
 
+    /**
+     *  @brief  Construct the node properties from Succinct ones in parallel.
+     *
+     *  Records are laid out sequentially from the node lengths; then the
+     *  characters are decoded into the arena in parallel.
+     */
     inline void
-    shrink_to_fit( )
+    construct( succinct_type const& other )
     {
-      this->nodes.shrink_to_fit();
-    }
+      this->clear();
+      size_type count = other.size();
+      this->records.resize( count );
 
-  private:
-    /* === DATA MEMBERS === */
-    container_type nodes;
-    typename sequence_type::size_type sequences_len_sum;
-    typename string_type::size_type names_len_sum;
+      #pragma omp parallel for schedule( static )
+      for ( size_type i = 0; i < count; ++i ) {
+        this->records[ i ].seq_len = other.sequences()[ i ].size();
+        this->records[ i ].name_len = other.names()[ i ].size();
+      }
+
+      std::vector< std::size_t > chunk_sizes;
+      for ( record_type& rec : this->records ) {
+        std::size_t len = rec.seq_len + rec.name_len;
+        if ( chunk_sizes.empty() || trait_type::CHUNK_CAPACITY < chunk_sizes.back() + len ) {
+          chunk_sizes.push_back( 0 );
+        }
+        rec.chunk = chunk_sizes.size() - 1;
+        rec.offset = chunk_sizes.back();
+        chunk_sizes.back() += len;
+        this->sequences_len_sum += rec.seq_len;
+        this->names_len_sum += rec.name_len;
+      }
+      this->chunks.resize( chunk_sizes.size() );
+      for ( size_type i = 0; i < chunk_sizes.size(); ++i ) this->chunks[ i ].resize( chunk_sizes[ i ] );
+
+      #pragma omp parallel for schedule( static )
+      for ( size_type i = 0; i < count; ++i ) {
+        record_type const& rec = this->records[ i ];
+        auto seq = other.sequences()[ i ];
+        auto name = other.names()[ i ];
+        char* dst = this->chunks[ rec.chunk ].data() + rec.offset;
+        std::copy( name.begin(), name.end(), std::copy( seq.begin(), seq.end(), dst ) );
+      }
+    }
   };  /* --- end of template class NodeProperty --- */
 
   /**
@@ -2079,6 +3965,10 @@ namespace gum {
    *  Represent data associated with each edge, mainly directionality. Each data
    *  structure associated with each edge are stored in a hash map with node ID
    *  pairs as keys.
+   *
+   *  Only non-default edge properties (e.g. non-zero overlaps) are stored. Any
+   *  edge which is not in the map has the default property. So, a graph whose
+   *  edges have no overlaps does not pay for the map at all.
    */
   template< typename TDir, uint8_t ...TWidths >
   class EdgeProperty< Dynamic, TDir, TWidths... > {
@@ -2094,6 +3984,7 @@ namespace gum {
     using key_type = typename trait_type::key_type;
     using value_type = typename trait_type::value_type;
     using container_type = typename trait_type::container_type;
+    using size_type = typename container_type::size_type;
 
     /* === LIFECYCLE === */
     EdgeProperty( )
@@ -2116,31 +4007,82 @@ namespace gum {
     EdgeProperty& operator=( EdgeProperty const& other ) = default;      /* copy assignment operator */
     EdgeProperty& operator=( EdgeProperty&& other ) noexcept = default;  /* move assignment operator */
 
+    /**
+     *  @brief  Get the property of the edge `sides`.
+     *
+     *  The default property is returned for the edges with no stored property.
+     *  The caller is responsible for checking that the edge exists in the graph.
+     */
     inline edge_type const&
     operator[]( key_type sides ) const
     {
-      return this->edges.find( sides )->second;
+      if ( this->edges.empty() ) return trait_type::default_value();
+      auto found = this->edges.find( sides );
+      if ( found == this->edges.end() ) return trait_type::default_value();
+      return found->second;
     }
 
     /* === METHODS === */
+    /**
+     *  @brief  Get the property of the edge `sides`; same as `operator[]`.
+     *
+     *  NOTE: Since only non-default properties are stored, this map cannot tell
+     *  an edge with the default property from a non-existent one. So, unlike
+     *  earlier versions, it does not throw for non-existent edges; it returns
+     *  the default property for them. Check the edge by `has_edge` of the graph
+     *  first where that matters; otherwise prefer `operator[]`.
+     */
     inline edge_type const&
     at( key_type sides ) const
     {
-      auto found = this->edges.find( sides );
-      if ( found == this->edges.end() ) throw std::runtime_error( "no such edge" );
-      return found->second;
+      return ( *this )[ sides ];
     }
 
+    /**
+     *  @brief  Set the property of the edge `sides`.
+     *
+     *  Default properties are not stored; any previously stored property of
+     *  the edge is dropped in that case.
+     */
     inline void
     add_edge( key_type sides, value_type edge )
     {
+      if ( edge.is_default() ) {
+        this->remove_edge( sides );
+        return;
+      }
       this->edges[ sides ] = edge;
     }
 
+    inline void
+    remove_edge( key_type sides )
+    {
+      if ( this->edges.empty() ) return;
+      this->edges.erase( sides );
+    }
+
+    /**
+     *  @brief  Whether all edges have the default property.
+     */
     inline bool
-    has_edge( key_type sides ) const
+    all_default( ) const
+    {
+      return this->edges.empty();
+    }
+
+    /**
+     *  @brief  Return the number of edges with a non-default property.
+     */
+    inline size_type
+    size( ) const
     {
-      return this->edges.find( sides ) != this->edges.end();
+      return this->edges.size();
+    }
+
+    inline void
+    reserve( size_type size )
+    {
+      this->edges.reserve( size );
     }
 
     inline void
@@ -2149,6 +4091,12 @@ namespace gum {
       this->edges.clear();
     }
 
+    inline void
+    shrink_to_fit( )
+    {
+      this->edges.rehash( 0 );
+    }
+
   private:
     /* === DATA MEMBERS === */
     container_type edges;
@@ -2188,6 +4136,13 @@ namespace gum {
       trait_type::init_rank_map( this->path_rank );
     }
 
+    template< typename TCoordinate = coordinate::IdentityBase< id_type > >
+    GraphProperty( succinct_type const& other, TCoordinate&& coord={} )
+      : GraphProperty( )
+    {
+      this->construct( other, coord );
+    }
+
     GraphProperty( GraphProperty const& other ) = default;      /* copy constructor */
     GraphProperty( GraphProperty&& other ) noexcept = default;  /* move constructor */
     ~GraphProperty() noexcept = default;
@@ -2311,6 +4266,32 @@ namespace gum {
       }
     }
 
+    /**
+     *  @brief  Remove the step at position `pos` of a path.
+     *
+     *  The steps after `pos` are shifted back by one position.
+     */
+    inline void
+    remove_path_step( id_type id, size_type pos )
+    {
+      this->path( id ).remove_node( pos );
+    }
+
+    /**
+     *  @brief  Drop the steps on nodes satisfying `removed`.
+     */
+    template< typename TPredicate >
+    inline void
+    compact( TPredicate removed )
+    {
+      static_assert( std::is_invocable_r_v< bool, TPredicate, id_type >, "received a non-invocable as predicate" );
+
+      for ( auto& path : this->paths ) {
+        path.compact( removed );
+        path.shrink_to_fit();
+      }
+    }
+
     inline bool
     has_path( id_type id ) const
     {
@@ -2454,6 +4435,38 @@ namespace gum {
     {
       this->set_rank( this->paths.end() - 1, this->paths.end() );
     }
+
+    /**
+     *  @brief  Construct the paths from Succinct ones.
+     *
+     *  Path IDs and ranks of the Succinct paths are preserved. Node IDs in the
+     *  paths are translated by `coord`. Paths are filled in parallel.
+     *
+     *  @param  other Succinct graph property.
+     *  @param  coord Translate a node ID in `other` to a node ID in this graph.
+     */
+    template< typename TCoordinate = coordinate::IdentityBase< id_type > >
+    inline void
+    construct( succinct_type const& other, TCoordinate&& coord={} )
+    {
+      this->clear();
+      rank_type count = other.get_path_count();
+      this->paths.assign( count, value_type( 0 ) );
+
+      #pragma omp parallel for schedule( dynamic, 1 )
+      for ( rank_type rank = 1; rank <= count; ++rank ) {
+        auto path = other.path( other.rank_to_id( rank ) );
+        value_type d_path( path.get_id(), path.get_name() );
+        d_path.reserve( path.size() );
+        for ( auto const& node : path ) {
+          d_path.add_node( coord( path.id_of( node ) ), path.is_reverse( node ) );
+        }
+        this->paths[ rank - 1 ] = std::move( d_path );
+      }
+      if ( count != 0 ) this->max_id = this->paths.back().get_id();
+      this->path_rank.reserve( count );
+      this->set_rank();
+    }
   };  /* --- end of template class GraphProperty --- */
 
   /**
@@ -2504,7 +4517,8 @@ namespace gum {
     GraphProperty( GraphProperty const& other )
       : path_count( other.path_count ),
         paths( other.paths ),
-        ids_bv( other.ids_bv )
+        ids_bv( other.ids_bv ),
+        names( other.names )
     {
       sdsl::util::init_support( this->path_rank, &this->ids_bv );
       sdsl::util::init_support( this->path_id, &this->ids_bv );
@@ -2514,7 +4528,8 @@ namespace gum {
     GraphProperty( GraphProperty&& other ) noexcept
       : path_count( other.path_count ),
         paths( std::move( other.paths ) ),
-        ids_bv( std::move( other.ids_bv ) )
+        ids_bv( std::move( other.ids_bv ) ),
+        names( std::move( other.names ) )
     {
       sdsl::util::init_support( this->path_rank, &this->ids_bv );
       sdsl::util::init_support( this->path_id, &this->ids_bv );
@@ -2541,6 +4556,7 @@ namespace gum {
       this->path_count = other.path_count;
       this->paths = other.paths;
       this->ids_bv = other.ids_bv;
+      this->names = other.names;
       sdsl::util::init_support( this->path_rank, &this->ids_bv );
       sdsl::util::init_support( this->path_id, &this->ids_bv );
       return *this;
@@ -2553,6 +4569,7 @@ namespace gum {
       this->path_count = other.path_count;
       this->paths = std::move( other.paths );
       this->ids_bv = std::move( other.ids_bv );
+      this->names = std::move( other.names );
       sdsl::util::init_support( this->path_rank, &this->ids_bv );
       sdsl::util::init_support( this->path_id, &this->ids_bv );
       return *this;
@@ -2841,6 +4858,7 @@ namespace gum {
     using typename base_type::side_type;
     using typename base_type::link_type;
     using typename base_type::linktype_type;
+    using typename base_type::edge_handle_type;
     using typename base_type::string_type;
     using typename base_type::coordspec_type;
     using typename base_type::coordinate_type;
@@ -2862,6 +4880,17 @@ namespace gum {
 
     /* === LIFECYCLE === */
     SeqGraph() = default;                                  /* constructor      */
+
+    template< typename TCSpec >
+    SeqGraph( succinct_template< TCSpec > const& s_graph )
+      : base_type( s_graph ),
+        node_prop( s_graph.get_node_prop( ) ),
+        graph_prop( s_graph.get_graph_prop( ),
+                    [&s_graph]( id_type id ) { return s_graph.coordinate_id( id ); } )
+    {
+      this->fill_properties( s_graph );
+    }
+
     SeqGraph( SeqGraph const& other ) = default;           /* copy constructor */
     SeqGraph( SeqGraph&& other ) noexcept = default;       /* move constructor */
     ~SeqGraph() noexcept = default;                        /* destructor       */
@@ -2885,6 +4914,12 @@ namespace gum {
       return this->edge_prop;
     }
 
+    inline edge_type const&
+    get_edge_prop( edge_handle_type handle ) const
+    {
+      return this->edge_prop[ handle ];
+    }
+
     inline graph_prop_type const&
     get_graph_prop( ) const
     {
@@ -2901,6 +4936,19 @@ namespace gum {
     SeqGraph& operator=( SeqGraph const& other ) = default;      /* copy assignment operator */
     SeqGraph& operator=( SeqGraph&& other ) noexcept = default;  /* move assignment operator */
 
+    template< typename TCSpec >
+    inline SeqGraph&
+    operator=( succinct_template< TCSpec > const& s_graph )
+    {
+      base_type::operator=( s_graph );
+      this->node_prop = s_graph.get_node_prop( );
+      this->graph_prop = graph_prop_type(
+          s_graph.get_graph_prop( ),
+          [&s_graph]( id_type id ) { return s_graph.coordinate_id( id ); } );
+      this->fill_properties( s_graph );
+      return *this;
+    }
+
     /* === METHODS === */
     inline rank_type
     path_id_to_rank( id_type id ) const
@@ -2939,6 +4987,35 @@ namespace gum {
       base_type::add_nodes( count, callback );
     }
 
+    /**
+     *  @brief  Add nodes in the range [begin, end) to the graph.
+     *
+     *  Each element of the range is a pair of a node and its external ID (zero if
+     *  it should be chosen internally). The nodes are moved from the range if it
+     *  is given by move iterators.
+     *
+     *  @param  begin The begin iterator of the range of (node, ID) pairs.
+     *  @param  end The end iterator of the range of (node, ID) pairs.
+     *  @param  callback A function to be called on IDs of added nodes in order.
+     */
+    template< typename TIter, typename TCallback = void(*)( id_type ) >
+    inline void
+    add_nodes_bulk( TIter begin, TIter end,
+                    TCallback callback = []( id_type ){} )
+    {
+      static_assert( std::is_invocable_v< TCallback, id_type >, "received a non-invocable as callback" );
+
+      size_type count = std::distance( begin, end );
+      base_type::reserve_nodes( count );
+      this->node_prop.reserve( this->node_prop.size() + count );
+      for ( ; begin != end; ++begin ) {
+        auto&& elem = *begin;
+        id_type id = base_type::add_ranked_node_imp( elem.second );
+        this->node_prop.add_node( std::forward< decltype( elem ) >( elem ).first );
+        callback( id );
+      }
+    }
+
     inline void
     update_node( id_type id, node_type node )
     {
@@ -2949,6 +5026,7 @@ namespace gum {
     inline void
     sort_nodes()
     {
+      this->apply_order();
       auto perm = base_type::sort_nodes();
       this->node_prop.sort_nodes( perm );
     }
@@ -2961,6 +5039,27 @@ namespace gum {
       this->node_prop.sort_nodes( perm );
     }
 
+    /**
+     *  @brief  Reorder node ranks by `perm` without moving nodes or their properties.
+     *
+     *  Suitable when the graph is about to be converted to a Succinct one. See
+     *  `DirectedGraph< Dynamic >::sort_nodes( perm, Lazy )`.
+     */
+    template< typename TContainer >
+    inline void
+    sort_nodes( TContainer const& perm, Lazy )
+    {
+      base_type::sort_nodes( perm, Lazy{} );
+      this->node_prop.sort_nodes( perm, Lazy{} );
+    }
+
+    inline void
+    apply_order( )
+    {
+      base_type::apply_order();
+      this->node_prop.apply_order();
+    }
+
     inline void
     add_edge( link_type sides, edge_type edge=edge_type() )
     {
@@ -2975,10 +5074,30 @@ namespace gum {
       this->add_edge( base_type::make_link( from, to ), edge );
     }
 
+    /**
+     *  @brief  Add edges in the range [begin, end) to the graph.
+     *
+     *  Each element of the range is a pair of a link and its edge property.
+     *  Repeated links in the range and the ones already in the graph are skipped;
+     *  i.e. the first occurrence of a link determines its property.
+     *
+     *  @param  begin The begin iterator of the range of (link, edge) pairs.
+     *  @param  end The end iterator of the range of (link, edge) pairs.
+     */
+    template< typename TIter >
+    inline void
+    add_edges_bulk( TIter begin, TIter end )
+    {
+      base_type::add_edges_bulk_imp(
+          begin, end,
+          []( auto const& elem ) -> link_type { return elem.first; },
+          [this]( auto const& elem ) { this->edge_prop.add_edge( elem.first, elem.second ); } );
+    }
+
     inline bool
     has_edge( link_type sides ) const
     {
-      return this->edge_prop.has_edge( sides );
+      return base_type::has_edge( sides );
     }
 
     inline bool
@@ -2987,6 +5106,79 @@ namespace gum {
       return this->has_edge( base_type::make_link( from, to ) );
     }
 
+    /**
+     *  @brief  Remove a node and its incident edges.
+     *
+     *  The node properties are kept as a tombstone until the graph is
+     *  compacted. Path steps on the removed node are dropped by `compact`.
+     */
+    inline void
+    remove_node( id_type id )
+    {
+      base_type::remove_node_imp(
+          id,
+          [this]( link_type sides ) {
+            this->edge_prop.remove_edge( sides );
+          } );
+    }
+
+    inline void
+    remove_edge( link_type sides )
+    {
+      assert( this->has_edge( sides ) );
+      base_type::remove_edge( sides );
+      this->edge_prop.remove_edge( sides );
+    }
+
+    inline void
+    remove_edge( side_type from, side_type to )
+    {
+      this->remove_edge( base_type::make_link( from, to ) );
+    }
+
+    inline void
+    remove_edge( id_type from, id_type to,
+                 linktype_type type=base_type::trait_type::get_default_linktype() )
+    {
+      this->remove_edge( base_type::make_link( from, to, type ) );
+    }
+
+    /**
+     *  @brief  Remove the step at position `pos` (0-based) of a path.
+     *
+     *  The step is erased immediately; so the steps after `pos` are shifted
+     *  back by one position and the graph stays compact (see `is_compact`).
+     */
+    inline void
+    remove_path_step( id_type pid, size_type pos )
+    {
+      this->graph_prop.remove_path_step( pid, pos );
+    }
+
+    /**
+     *  @brief  Drop all tombstones in one pass over each component.
+     *
+     *  Node ranks are renumbered, the rank map is rebuilt, and the storage of
+     *  node and edge properties is shrunk. Path steps that visit removed nodes
+     *  are dropped.
+     */
+    inline void
+    compact( )
+    {
+      this->apply_order();
+      auto const& nodes = base_type::get_nodes();
+      this->node_prop.compact(
+          [&nodes]( rank_type rank ) {
+            return nodes[ rank - 1 ] == 0;
+          } );
+      this->edge_prop.shrink_to_fit();
+      this->graph_prop.compact(
+          [this]( id_type id ) {
+            return !this->has_node( id );
+          } );
+      base_type::compact();
+    }
+
     inline id_type
     add_path( string_type name )
     {
@@ -3047,6 +5239,28 @@ namespace gum {
       return this->node_sequence( id ).size();
     }
 
+    /**
+     *  @brief  Copy the characters in [begin_pos, end_pos) of the node sequence to `d_first`.
+     */
+    template< typename TOutputIt >
+    inline TOutputIt
+    extract_node_sequence( id_type id, offset_type begin_pos, offset_type end_pos,
+                           TOutputIt d_first ) const
+    {
+      auto seq = this->node_sequence( id );
+      assert( begin_pos <= end_pos && end_pos <= seq.size() );
+      return std::copy( seq.begin() + begin_pos, seq.begin() + end_pos, d_first );
+    }
+
+    /**
+     *  @brief  Whether any edge in the graph has a non-zero overlap.
+     */
+    inline bool
+    has_edge_overlaps( ) const
+    {
+      return !this->edge_prop.all_default();
+    }
+
     inline offset_type
     edge_overlap( link_type sides ) const
     {
@@ -3055,7 +5269,7 @@ namespace gum {
 
     inline offset_type
     edge_overlap( id_type from, id_type to,
-                  linktype_type type=base_type::get_default_linktype() ) const
+                  linktype_type type=base_type::trait_type::get_default_linktype() ) const
     {
       return this->edge_overlap( this->make_link( from, to, type ) );
     }
@@ -3109,12 +5323,6 @@ namespace gum {
       return this->node_prop;
     }
 
-    inline node_type&
-    get_node_prop( rank_type rank )
-    {
-      return this->node_prop( rank );
-    }
-
     inline edge_prop_type&
     get_edge_prop( )
     {
@@ -3132,6 +5340,52 @@ namespace gum {
     node_prop_type node_prop;
     edge_prop_type edge_prop;
     graph_prop_type graph_prop;
+
+    /* === METHODS === */
+    /**
+     *  @brief  Fill edge properties from a Succinct graph.
+     *
+     *  Non-zero edge overlaps are gathered per node in parallel, and then
+     *  inserted into the edge property map in rank order. Nothing is scanned
+     *  if the Succinct graph stores no overlaps.
+     */
+    template< typename TCSpec >
+    inline void
+    fill_properties( succinct_template< TCSpec > const& s_graph )
+    {
+      using out_edges_type = std::vector< std::pair< link_type, offset_type > >;
+
+      this->edge_prop.clear();
+      if ( !s_graph.has_edge_overlaps() ) return;
+
+      rank_type count = s_graph.get_node_count();
+      std::vector< out_edges_type > edges( count );
+
+      #pragma omp parallel for schedule( dynamic, 1024 )
+      for ( rank_type rank = 1; rank <= count; ++rank ) {
+        id_type s_id = s_graph.rank_to_id( rank );
+        id_type id = s_graph.coordinate_id( s_id );
+        auto& out_edges = edges[ rank - 1 ];
+        s_graph.for_each_edges_out(
+            s_id,
+            [&]( id_type to, linktype_type type, auto handle ) {
+              offset_type overlap = s_graph.edge_overlap( handle );
+              if ( overlap == 0 ) return true;
+              out_edges.emplace_back( this->make_link( id, s_graph.coordinate_id( to ), type ),
+                                      overlap );
+              return true;
+            } );
+      }
+
+      size_type nof_overlaps = 0;
+      for ( auto const& out_edges : edges ) nof_overlaps += out_edges.size();
+      this->edge_prop.reserve( nof_overlaps );
+      for ( auto const& out_edges : edges ) {
+        for ( auto const& edge : out_edges ) {
+          this->edge_prop.add_edge( edge.first, edge_type( edge.second ) );
+        }
+      }
+    }
   };  /* --- end of template class SeqGraph --- */
 
   /**
@@ -3176,6 +5430,7 @@ namespace gum {
     using typename base_type::side_type;
     using typename base_type::link_type;
     using typename base_type::linktype_type;
+    using typename base_type::edge_handle_type;
     using typename base_type::coordspec_type;
     using typename base_type::coordinate_type;
     using node_type = typename node_prop_type::node_type;
@@ -3208,9 +5463,21 @@ namespace gum {
       : base_type( SeqGraph::NODE_PADDING, SeqGraph::EDGE_PADDING )
     { }
 
+    explicit SeqGraph( bool out_only )
+      : base_type( SeqGraph::NODE_PADDING, SeqGraph::EDGE_PADDING, out_only )
+    { }
+
+    /**
+     *  @brief  Construct the succinct graph from a Dynamic one.
+     *
+     *  If no edge in `d_graph` has an overlap, the overlap field is dropped from
+     *  the edge entries and all overlaps are reported as zero (see
+     *  `has_edge_overlaps`).
+     */
     template< typename TCSpec >
-    SeqGraph( dynamic_template< TCSpec > const& d_graph )
-      : base_type( d_graph, SeqGraph::NODE_PADDING, SeqGraph::EDGE_PADDING ),
+    SeqGraph( dynamic_template< TCSpec > const& d_graph, bool out_only = false )
+      : base_type( d_graph, SeqGraph::NODE_PADDING,
+                   d_graph.has_edge_overlaps() ? SeqGraph::EDGE_PADDING : 0, out_only ),
         node_prop( d_graph.get_node_prop( ) ),
         graph_prop( d_graph.get_graph_prop( ), this->get_coordinate() )
     {
@@ -3254,11 +5521,8 @@ namespace gum {
     SeqGraph&
     operator=( dynamic_template< TCSpec > const& d_graph )
     {
-      base_type::operator=( d_graph );
-      this->node_prop = d_graph.get_node_prop( );
-      this->fill_properties( d_graph );
-      this->graph_prop = d_graph.get_graph_prop( );
-      this->graph_prop.apply_coordinate( this->get_coordinate() );
+      // The edge entry layout depends on `d_graph`; so the graph is rebuilt.
+      *this = SeqGraph( d_graph, this->is_out_only() );
       return *this;
     }
 
@@ -3305,10 +5569,39 @@ namespace gum {
       return this->get_np_value( id, SeqGraph::NP_SEQLEN_OFFSET );
     }
 
+    /**
+     *  @brief  Decode the characters in [begin_pos, end_pos) of the node sequence into `d_first`.
+     *
+     *  Unlike iterating over `node_sequence( id )`, it decodes the packed
+     *  sequence a word at a time.
+     */
+    template< typename TOutputIt >
+    inline TOutputIt
+    extract_node_sequence( id_type id, offset_type begin_pos, offset_type end_pos,
+                           TOutputIt d_first ) const
+    {
+      assert( begin_pos <= end_pos && end_pos <= this->node_length( id ) );
+      size_type spos = this->get_np_value( id, SeqGraph::NP_SEQSTART_OFFSET );
+      return this->node_prop.sequences().extract( spos + begin_pos, spos + end_pos, d_first );
+    }
+
+    /**
+     *  @brief  Whether the edge entries store overlaps.
+     *
+     *  It is false if all edges of the graph had zero overlaps at construction
+     *  time; in which case, the overlap of every edge is zero.
+     */
+    inline bool
+    has_edge_overlaps( ) const
+    {
+      return this->get_edge_padding() != 0;
+    }
+
     inline offset_type
     edge_overlap( id_type from, id_type to,
-                  linktype_type type=base_type::get_default_linktype() ) const
+                  linktype_type type=base_type::trait_type::get_default_linktype() ) const
     {
+      if ( !this->has_edge_overlaps() ) return 0;
       auto fod = this->outdegree( from );
       auto tod = this->indegree( to );
       offset_type overlap = 0;
@@ -3326,7 +5619,7 @@ namespace gum {
                      return true;
                    };
           };
-      if ( fod < tod ) {
+      if ( fod < tod || this->is_out_only() ) {
         success = !this->for_each_edges_out_pos( from, setoverlap( to, type ) );
         assert( success );
       }
@@ -3351,6 +5644,23 @@ namespace gum {
                                  this->linktype( sides ) );
     }
 
+    /**
+     *  @brief  Get the overlap of an edge given its handle.
+     *
+     *  @param  handle The edge handle passed by `for_each_edges_out` or
+     *                 `for_each_edges_in` to the callback.
+     *  @return The edge overlap.
+     *
+     *  NOTE: In contrast to other overloads, this one does not scan the
+     *  adjacency list and runs in constant time.
+     */
+    inline offset_type
+    edge_overlap( edge_handle_type handle ) const
+    {
+      if ( !this->has_edge_overlaps() ) return 0;
+      return this->get_ep_value( handle, SeqGraph::EP_OVERLAP_OFFSET );
+    }
+
     inline rank_type
     path_length( id_type id ) const
     {
@@ -3434,12 +5744,6 @@ namespace gum {
       this->set_nodes_at( this->edge_prop_pos( pos ) + offset, value );
     }
 
-    inline offset_type
-    edge_overlap( size_type pos ) const
-    {
-      return this->get_ep_value( pos, SeqGraph::EP_OVERLAP_OFFSET );
-    }
-
   private:
     /* === DATA MEMBERS === */
     node_prop_type node_prop;
@@ -3456,6 +5760,7 @@ namespace gum {
                                 this->node_prop.sequences().start_position( rank - 1 ) );
             this->set_np_value( id, SeqGraph::NP_SEQLEN_OFFSET,
                                 this->node_prop.sequences().length( rank - 1 ) );
+            if ( !this->has_edge_overlaps() ) return true;
             id_type d_id = d_graph.rank_to_id( rank );
             this->for_each_edges_out_pos(
                 id,
@@ -3507,6 +5812,22 @@ namespace gum {
   class DiSeqGraph< Succinct, TCoordSpec, TWidths... >
     : public DirectedGraph< Succinct, Directed, TCoordSpec, TWidths... > {
   };
+
+  /**
+   *  @brief  Succinct sequence graph with integer widths selected at runtime.
+   *
+   *  The alternatives are ordered from the narrowest to the widest integer
+   *  widths. The narrowest one which can represent a given graph is selected by
+   *  `util::make_succinct_variant`; algorithms are then dispatched by
+   *  `std::visit`.
+   */
+  template< typename TCoordSpec = void,
+            template< class, uint8_t ... > class TNodeProp = DefaultNodeProperty,
+            template< class, class, uint8_t ... > class TEdgeProp = DefaultEdgeProperty,
+            template< class, class, uint8_t ... > class TGraphProp = DefaultGraphProperty >
+  using SeqGraphVariant =
+      std::variant< SeqGraph< Succinct, TCoordSpec, TNodeProp, TEdgeProp, TGraphProp, 32, 32 >,
+                    SeqGraph< Succinct, TCoordSpec, TNodeProp, TEdgeProp, TGraphProp > >;
 }  /* --- end of namespace gum --- */
 
 #endif  /* --- #ifndef GUM_SEQGRAPH_HPP__ --- */
@@ -19,6 +19,12 @@
 #define  GUM_SEQGRAPH_BASE_HPP__
 
 #include <string>
+#include <string_view>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <cassert>
 #include <vector>
 #include <utility>
 #include <tuple>
@@ -38,6 +44,274 @@ namespace gum {
   /* Graph bidirected specialization tag. */
   struct Bidirected;
 
+  /**
+   *  @brief  Map from node IDs to node ranks.
+   *
+   *  Ranks are kept in an array indexed by node ID as long as the IDs are
+   *  dense; i.e. the range of IDs spans at most `DENSITY` times the number of
+   *  nodes (plus `SLACK`). When IDs turn out to be sparse, it falls back to a
+   *  hash map. The array is reconsidered whenever the map is cleared or rebuilt
+   *  by `assign`.
+   *
+   *  Rank zero denotes a non-existent node, so it cannot be stored.
+   */
+  template< typename TId, typename TRank >
+  class RankMap {
+  public:
+    /* === TYPEDEFS === */
+    using id_type = TId;
+    using rank_type = TRank;
+    using size_type = std::size_t;
+    using dense_type = std::vector< rank_type >;
+    using sparse_type = phmap::flat_hash_map< id_type, rank_type >;
+
+    /* === CONSTANTS === */
+    constexpr static size_type DENSITY = 2;
+    constexpr static size_type SLACK = 1024;
+
+    /* === LIFECYCLE === */
+    RankMap( )                                                /* constructor      */
+      : base( 0 ), count( 0 ), hint( 0 ), dense_mode( true )
+    { }
+
+    RankMap( RankMap const& other ) = default;                /* copy constructor */
+    RankMap( RankMap&& other ) noexcept = default;            /* move constructor */
+    ~RankMap( ) noexcept = default;                           /* destructor       */
+
+    /* === OPERATORS === */
+    RankMap& operator=( RankMap const& other ) = default;      /* copy assignment operator */
+    RankMap& operator=( RankMap&& other ) noexcept = default;  /* move assignment operator */
+
+    /* === METHODS === */
+    /**
+     *  @brief  Return the rank of `id` or zero if it is not in the map.
+     */
+    inline rank_type
+    get( id_type id ) const
+    {
+      if ( this->dense_mode ) {
+        size_type idx = this->index_of( id );
+        return idx < this->dense.size() ? this->dense[ idx ] : 0;
+      }
+      auto found = this->sparse.find( id );
+      if ( found == this->sparse.end() ) return 0;
+      return found->second;
+    }
+
+    inline bool
+    contains( id_type id ) const
+    {
+      return this->get( id ) != 0;
+    }
+
+    /**
+     *  @brief  Insert `id` with `rank` if it is not already in the map.
+     *
+     *  @return `true` if inserted; `false` if `id` already exists.
+     */
+    inline bool
+    insert( id_type id, rank_type rank )
+    {
+      assert( rank != 0 );
+      if ( this->dense_mode && this->fit( id ) ) {
+        rank_type& slot = this->dense[ this->index_of( id ) ];
+        if ( slot != 0 ) return false;
+        slot = rank;
+        ++this->count;
+        return true;
+      }
+      bool inserted = this->sparse.insert( { id, rank } ).second;
+      if ( inserted ) ++this->count;
+      return inserted;
+    }
+
+    inline void
+    erase( id_type id )
+    {
+      if ( this->dense_mode ) {
+        size_type idx = this->index_of( id );
+        if ( idx >= this->dense.size() || this->dense[ idx ] == 0 ) return;
+        this->dense[ idx ] = 0;
+        --this->count;
+        return;
+      }
+      this->count -= this->sparse.erase( id );
+    }
+
+    /**
+     *  @brief  Rebuild the map from the IDs in the range [begin, end).
+     *
+     *  The rank of each ID is its position in the range (1-based). Zero IDs
+     *  (e.g. tombstones) are skipped. The representation is chosen by the range
+     *  of the IDs before any insertion. The array is filled in parallel, which
+     *  requires IDs in the range to be unique; duplicates are only detected.
+     *
+     *  @return `false` if there are duplicate IDs in the range.
+     */
+    template< typename TIter >
+    inline bool
+    assign( TIter begin, TIter end )
+    {
+      static_assert( std::is_same< typename std::iterator_traits< TIter >::iterator_category,
+                                   std::random_access_iterator_tag >::value,
+                     "random access iterators are required" );
+
+      this->clear();
+      size_type len = end - begin;
+      id_type lo = std::numeric_limits< id_type >::max();
+      id_type hi = 0;
+      size_type n = 0;
+
+      #pragma omp parallel for schedule( static ) reduction( min:lo ) reduction( max:hi ) reduction( +:n )
+      for ( size_type i = 0; i < len; ++i ) {
+        id_type id = begin[ i ];
+        if ( id == 0 ) continue;
+        if ( id < lo ) lo = id;
+        if ( hi < id ) hi = id;
+        ++n;
+      }
+      if ( n == 0 ) return true;
+
+      if ( !RankMap::is_dense( hi - lo + 1, n ) ) {
+        this->to_sparse();
+        this->sparse.reserve( n );
+        for ( size_type i = 0; i < len; ++i ) {
+          id_type id = begin[ i ];
+          if ( id != 0 ) this->sparse.insert( { id, static_cast< rank_type >( i + 1 ) } );
+        }
+        this->count = this->sparse.size();
+        return this->count == n;
+      }
+
+      this->base = lo;
+      this->dense.assign( hi - lo + 1, 0 );
+      #pragma omp parallel for schedule( static )
+      for ( size_type i = 0; i < len; ++i ) {
+        id_type id = begin[ i ];
+        if ( id != 0 ) this->dense[ this->index_of( id ) ] = i + 1;
+      }
+      size_type stored = 0;
+      #pragma omp parallel for schedule( static ) reduction( +:stored )
+      for ( size_type i = 0; i < this->dense.size(); ++i ) {
+        if ( this->dense[ i ] != 0 ) ++stored;
+      }
+      this->count = stored;
+      return this->count == n;
+    }
+
+    inline void
+    clear( )
+    {
+      this->dense.clear();
+      this->dense.shrink_to_fit();
+      this->sparse.clear();
+      this->base = 0;
+      this->count = 0;
+      this->hint = 0;
+      this->dense_mode = true;
+    }
+
+    /**
+     *  @brief  Reserve space for a total of `size` IDs.
+     */
+    inline void
+    reserve( size_type size )
+    {
+      this->hint = std::max( this->hint, size );
+      if ( !this->dense_mode ) this->sparse.reserve( size );
+    }
+
+    inline size_type
+    size( ) const
+    {
+      return this->count;
+    }
+
+    inline bool
+    empty( ) const
+    {
+      return this->count == 0;
+    }
+
+    /**
+     *  @brief  Whether the ranks are stored in an array indexed by IDs.
+     */
+    inline bool
+    is_dense( ) const
+    {
+      return this->dense_mode;
+    }
+
+  private:
+    /* === DATA MEMBERS === */
+    dense_type dense;    /**< @brief Rank of ID `base + i` at index `i` (dense mode) */
+    sparse_type sparse;  /**< @brief ID to rank hash map (sparse mode) */
+    id_type base;
+    size_type count;
+    size_type hint;      /**< @brief Expected number of IDs */
+    bool dense_mode;
+
+    /* === METHODS === */
+    static inline bool
+    is_dense( size_type span, size_type n )
+    {
+      return span <= RankMap::DENSITY * n + RankMap::SLACK;
+    }
+
+    inline size_type
+    index_of( id_type id ) const
+    {
+      // IDs less than `base` wrap around to large indices.
+      return static_cast< size_type >( id ) - static_cast< size_type >( this->base );
+    }
+
+    /**
+     *  @brief  Extend the array to cover `id` if the IDs remain dense.
+     *
+     *  @return `false` if the map switched to the hash map instead.
+     */
+    inline bool
+    fit( id_type id )
+    {
+      if ( this->dense.empty() ) this->base = id;
+      size_type idx = this->index_of( id );
+      if ( idx < this->dense.size() ) return true;
+      size_type n = std::max( this->count + 1, this->hint );
+      if ( id < this->base ) {
+        size_type grow = this->base - id;
+        if ( !RankMap::is_dense( this->dense.size() + grow, n ) ) {
+          this->to_sparse();
+          return false;
+        }
+        // Leave headroom below `id` to amortise the cost of shifting.
+        size_type room = std::min( { this->dense.size(), static_cast< size_type >( id - 1 ),
+                                     RankMap::DENSITY * n + RankMap::SLACK - this->dense.size() - grow } );
+        grow += room;
+        this->dense.insert( this->dense.begin(), grow, 0 );
+        this->base -= grow;
+        return true;
+      }
+      if ( !RankMap::is_dense( idx + 1, n ) ) {
+        this->to_sparse();
+        return false;
+      }
+      this->dense.resize( idx + 1, 0 );
+      return true;
+    }
+
+    inline void
+    to_sparse( )
+    {
+      this->sparse.reserve( std::max( this->count, this->hint ) );
+      for ( size_type i = 0; i < this->dense.size(); ++i ) {
+        if ( this->dense[ i ] != 0 ) this->sparse.insert( { static_cast< id_type >( this->base + i ), this->dense[ i ] } );
+      }
+      this->dense.clear();
+      this->dense.shrink_to_fit();
+      this->dense_mode = false;
+    }
+  };  /* --- end of template class RankMap --- */
+
   /**
    *  @brief  General graph trait.
    *
@@ -57,15 +331,12 @@ namespace gum {
     using nodes_type = std::vector< id_type >;
     using size_type = typename nodes_type::size_type;
     using rank_type = typename nodes_type::size_type;
-    using rank_map_type = phmap::flat_hash_map< id_type, rank_type >;
+    using rank_map_type = RankMap< id_type, rank_type >;
     using string_type = std::string;  // for node and path names
 
     static inline void
-    init_rank_map( rank_map_type& m )
-    {
-      // `dense_hash_map` requires to set empty key before any `insert` call.
-      //m.set_empty_key( 0 );  // ID cannot be zero, so it can be used as empty key.
-    }
+    init_rank_map( rank_map_type& )
+    { }
   };  /* --- end of template class GraphBaseTrait --- */
 
   /**
@@ -144,6 +415,123 @@ namespace gum {
     }
   };  /* --- end of template class GraphBaseTrait --- */
 
+  /**
+   *  @brief  Compressed graph trait.
+   *
+   *  The graph is stored as a byte stream of node records in rank order in
+   *  which node IDs are node ranks. Adjacent nodes are encoded by the
+   *  (zig-zag encoded) difference of their IDs and the ID of the node itself;
+   *  so that the small gaps, which are common in sorted graphs, occupy only
+   *  one or two bytes.
+   *
+   *  GRAPH := {NODE, ...}
+   *  NODE := {outdegree, indegree, EDGES_OUT, EDGES_IN}
+   *  EDGES_OUT := {EDGE_OUT, ...}
+   *  EDGES_IN := {EDGE_IN, ...}
+   *  EDGE_OUT(*) := {delta << LINKTYPE_BITS | type?}
+   *  EDGE_IN(*) := {delta << LINKTYPE_BITS | type?}
+   *
+   *  outdegree: varint
+   *  indegree: varint
+   *  delta: zig-zag encoded `adjacent ID - ID`
+   *  type: integer of `LINKTYPE_BITS` bits
+   *
+   *  All entries are written as variable-length integers (varint); i.e. in
+   *  groups of 7 bits, least significant group first, in which the most
+   *  significant bit of each byte indicates whether more bytes follow.
+   *
+   *  The node records are located by sampling the byte offset of every
+   *  `sample_rate`-th record; the records in between are reached by skipping
+   *  the varints of the preceding records from the closest sample.
+   *
+   *  (*) NOTE that the `type` field is only for Bidirected graphs and will be
+   *  omitted for directed graphs.
+   */
+  template< uint8_t TIdWidth, uint8_t TOffsetWidth >
+  class GraphBaseTrait< Compressed, TIdWidth, TOffsetWidth > {
+  public:
+    using id_type = integer_t< TIdWidth >;
+    using offset_type = uinteger_t< TOffsetWidth >;
+    using common_type = common< TIdWidth, TOffsetWidth >;
+    using value_type = typename common_type::type;
+    using nodes_type = sdsl::int_vector< 8 >;
+    using size_type = typename nodes_type::size_type;
+    using rank_type = typename nodes_type::size_type;
+    using samples_type = sdsl::int_vector<>;
+    using ids_type = sdsl::int_vector<>;
+    using code_type = uint64_t;
+    using string_type = std::string;  // for node and path names
+
+    constexpr static rank_type DEFAULT_SAMPLE_RATE = 16;
+    constexpr static unsigned int VARINT_BITS = 7;
+    constexpr static code_type VARINT_MASK = 0x7f;
+    constexpr static code_type VARINT_MORE = 0x80;
+
+    constexpr static inline code_type
+    zigzag( int64_t value )
+    {
+      return ( static_cast< code_type >( value ) << 1 ) ^ static_cast< code_type >( value >> 63 );
+    }
+
+    constexpr static inline int64_t
+    unzigzag( code_type code )
+    {
+      return static_cast< int64_t >( code >> 1 ) ^ -static_cast< int64_t >( code & 1 );
+    }
+
+    /**
+     *  @brief  Append a value as varint to the end of a byte container.
+     *
+     *  @param  bytes Reference to the byte container.
+     *  @param  value The value to be appended.
+     */
+    template< typename TContainer >
+    static inline void
+    put_varint( TContainer& bytes, code_type value )
+    {
+      while ( value >= GraphBaseTrait::VARINT_MORE ) {
+        bytes.push_back( ( value & GraphBaseTrait::VARINT_MASK ) | GraphBaseTrait::VARINT_MORE );
+        value >>= GraphBaseTrait::VARINT_BITS;
+      }
+      bytes.push_back( value );
+    }
+
+    /**
+     *  @brief  Read a varint from nodes array.
+     *
+     *  @param  nodes Reference to nodes array.
+     *  @param  pos Start position of the varint; it will be moved to the next one.
+     */
+    static inline code_type
+    get_varint( nodes_type const& nodes, size_type& pos )
+    {
+      code_type value = 0;
+      code_type byte;
+      unsigned int shift = 0;
+      do {
+        byte = nodes[ pos++ ];
+        value |= ( byte & GraphBaseTrait::VARINT_MASK ) << shift;
+        shift += GraphBaseTrait::VARINT_BITS;
+      } while ( byte & GraphBaseTrait::VARINT_MORE );
+      return value;
+    }
+
+    /**
+     *  @brief  Skip a number of varints in nodes array.
+     *
+     *  @param  nodes Reference to nodes array.
+     *  @param  pos Start position of the first varint; it will be moved after the last one.
+     *  @param  count Number of varints to be skipped.
+     */
+    static inline void
+    skip_varints( nodes_type const& nodes, size_type& pos, size_type count )
+    {
+      while ( count != 0 ) {
+        if ( !( nodes[ pos++ ] & GraphBaseTrait::VARINT_MORE ) ) --count;
+      }
+    }
+  };  /* --- end of template class GraphBaseTrait --- */
+
   /**
    *  @brief  General directed graph trait.
    *
@@ -648,6 +1036,19 @@ namespace gum {
     using typename base_type::link_type;
     using typename base_type::linktype_type;
     using adjs_type = std::vector< side_type >;
+    /**
+     *  NOTE: Sides are stored in adjacency maps as packed handles; i.e.
+     *  `id << 1 | sidetype`. A handle takes half of the space of a `side_type`
+     *  (which is padded to 16 bytes). The handle type is unsigned; so, any
+     *  non-negative node ID fits in it.
+     *
+     *  Adjacency lists keep up to `ADJS_INLINE_CAPACITY` handles inline which
+     *  covers most of the sides in sequence graphs; only the longer lists are
+     *  allocated on the heap.
+     */
+    using handle_type = std::make_unsigned_t< id_type >;
+    constexpr static std::size_t ADJS_INLINE_CAPACITY = 2;
+    using handles_type = SmallVector< handle_type, ADJS_INLINE_CAPACITY >;
 
     struct hash_side {
       inline std::size_t
@@ -666,7 +1067,36 @@ namespace gum {
       }
     };  /* --- end of struct hash_link --- */
 
-    using adj_map_type = phmap::flat_hash_map< side_type, adjs_type, hash_side >;
+    /**
+     *  @brief  Hash a packed side handle by a single multiplication.
+     *
+     *  Multiplying by an odd constant keeps the low bits (and so the side bit)
+     *  distinct for consecutive handles while spreading them over high bits.
+     */
+    struct hash_handle {
+      inline std::size_t
+      operator()( handle_type handle ) const
+      {
+        return static_cast< std::size_t >( handle ) * 0x9E3779B97F4A7C15ULL;
+      }
+    };  /* --- end of struct hash_handle --- */
+
+    using adj_map_type = phmap::flat_hash_map< handle_type, handles_type, hash_handle >;
+
+    constexpr static inline handle_type
+    handle_of( side_type side )
+    {
+      assert( static_cast< handle_type >( base_type::id_of( side ) ) >>
+              ( std::numeric_limits< handle_type >::digits - 1 ) == 0 );
+      return ( static_cast< handle_type >( base_type::id_of( side ) ) << 1 ) |
+          static_cast< handle_type >( side.second );
+    }
+
+    constexpr static inline side_type
+    side_of( handle_type handle )
+    {
+      return side_type( static_cast< id_type >( handle >> 1 ), handle & 1 );
+    }
 
     static inline void
     init_adj_map( adj_map_type& m )
@@ -699,6 +1129,14 @@ namespace gum {
     using typename base_type::link_type;
     using typename base_type::linktype_type;
     using adjs_type = std::vector< side_type >;
+    /**
+     *  NOTE: Sides of a directed graph are node IDs; so they are stored in
+     *  adjacency maps as is. Adjacency lists keep up to `ADJS_INLINE_CAPACITY`
+     *  handles inline.
+     */
+    using handle_type = id_type;
+    constexpr static std::size_t ADJS_INLINE_CAPACITY = 2;
+    using handles_type = SmallVector< handle_type, ADJS_INLINE_CAPACITY >;
 
     struct hash_side {
       inline std::size_t
@@ -716,7 +1154,20 @@ namespace gum {
       }
     };  /* --- end of struct hash_link --- */
 
-    using adj_map_type = phmap::flat_hash_map< side_type, adjs_type, hash_side >;
+    using hash_handle = std::hash< handle_type >;
+    using adj_map_type = phmap::flat_hash_map< handle_type, handles_type, hash_handle >;
+
+    constexpr static inline handle_type
+    handle_of( side_type side )
+    {
+      return base_type::id_of( side );
+    }
+
+    constexpr static inline side_type
+    side_of( handle_type handle )
+    {
+      return side_type( handle );
+    }
 
     static inline void
     init_adj_map( adj_map_type& m )
@@ -756,6 +1207,7 @@ namespace gum {
     constexpr static size_type EDGE_CORE_LEN = 2;
     constexpr static size_type ADJ_ID_OFFSET = 0;
     constexpr static size_type ADJ_LINKTYPE_OFFSET = 1;
+    constexpr static size_type ADJ_LINKTYPE_LEN = 1;
 
     /**
      *  @brief  Get the ID of the adjacent node from nodes array.
@@ -837,6 +1289,7 @@ namespace gum {
 
     constexpr static size_type EDGE_CORE_LEN = 1;
     constexpr static size_type ADJ_ID_OFFSET = 0;
+    constexpr static size_type ADJ_LINKTYPE_LEN = 0;
 
     /**
      *  @brief  Get the ID of the adjacent node from nodes array.
@@ -888,6 +1341,135 @@ namespace gum {
     }
   };  /* --- end of template class DirectedGraphTrait --- */
 
+  template< uint8_t ...TWidths >
+  class DirectedGraphTrait< Compressed, Bidirected, TWidths... >
+    : public GraphBaseTrait< Compressed, TWidths... >,
+      public DirectedGraphBaseTrait< Compressed, Bidirected, TWidths... > {
+  private:
+    using spec_type = Compressed;
+    using dir_type = Bidirected;
+    using graph_type = GraphBaseTrait< spec_type, TWidths... >;
+    using base_type = DirectedGraphBaseTrait< spec_type, dir_type, TWidths... >;
+  public:
+    using typename graph_type::id_type;
+    using typename graph_type::offset_type;
+    using typename graph_type::common_type;
+    using typename graph_type::value_type;
+    using typename graph_type::nodes_type;
+    using typename graph_type::size_type;
+    using typename graph_type::rank_type;
+    using typename graph_type::samples_type;
+    using typename graph_type::ids_type;
+    using typename graph_type::code_type;
+    using typename graph_type::string_type;
+    using typename base_type::side_type;
+    using typename base_type::link_type;
+    using typename base_type::linktype_type;
+    using adjs_type = std::vector< side_type >;
+
+    constexpr static unsigned int LINKTYPE_BITS = 2;
+    constexpr static code_type LINKTYPE_MASK = 0x3;
+
+    /**
+     *  @brief  Encode an edge entry of node `id` to the adjacent node.
+     *
+     *  @param  id The node ID.
+     *  @param  adj_id The adjacent node ID.
+     *  @param  type The link type.
+     */
+    constexpr static inline code_type
+    encode_adj( id_type id, id_type adj_id, linktype_type type )
+    {
+      return ( graph_type::zigzag( static_cast< int64_t >( adj_id ) - id )
+               << DirectedGraphTrait::LINKTYPE_BITS ) | type;
+    }
+
+    /**
+     *  @brief  Decode the ID of the adjacent node from an edge entry of node `id`.
+     *
+     *  @param  id The node ID.
+     *  @param  code The encoded edge entry.
+     */
+    constexpr static inline id_type
+    decode_adj_id( id_type id, code_type code )
+    {
+      return id + graph_type::unzigzag( code >> DirectedGraphTrait::LINKTYPE_BITS );
+    }
+
+    /**
+     *  @brief  Decode the type of the link to the adjacent node from an edge entry.
+     *
+     *  @param  code The encoded edge entry.
+     */
+    constexpr static inline linktype_type
+    decode_adj_linktype( code_type code )
+    {
+      return code & DirectedGraphTrait::LINKTYPE_MASK;
+    }
+  };  /* --- end of template class DirectedGraphTrait --- */
+
+  template< uint8_t ...TWidths >
+  class DirectedGraphTrait< Compressed, Directed, TWidths... >
+    : public GraphBaseTrait< Compressed, TWidths... >,
+      public DirectedGraphBaseTrait< Compressed, Directed, TWidths... > {
+  private:
+    using spec_type = Compressed;
+    using dir_type = Directed;
+    using graph_type = GraphBaseTrait< spec_type, TWidths... >;
+    using base_type = DirectedGraphBaseTrait< spec_type, dir_type, TWidths... >;
+  public:
+    using typename graph_type::id_type;
+    using typename graph_type::offset_type;
+    using typename graph_type::common_type;
+    using typename graph_type::value_type;
+    using typename graph_type::nodes_type;
+    using typename graph_type::size_type;
+    using typename graph_type::rank_type;
+    using typename graph_type::samples_type;
+    using typename graph_type::ids_type;
+    using typename graph_type::code_type;
+    using typename graph_type::string_type;
+    using typename base_type::side_type;
+    using typename base_type::link_type;
+    using typename base_type::linktype_type;
+    using adjs_type = std::vector< side_type >;
+
+    constexpr static unsigned int LINKTYPE_BITS = 0;
+
+    /**
+     *  @brief  Encode an edge entry of node `id` to the adjacent node.
+     *
+     *  @param  id The node ID.
+     *  @param  adj_id The adjacent node ID.
+     */
+    constexpr static inline code_type
+    encode_adj( id_type id, id_type adj_id, linktype_type )
+    {
+      return graph_type::zigzag( static_cast< int64_t >( adj_id ) - id );
+    }
+
+    /**
+     *  @brief  Decode the ID of the adjacent node from an edge entry of node `id`.
+     *
+     *  @param  id The node ID.
+     *  @param  code The encoded edge entry.
+     */
+    constexpr static inline id_type
+    decode_adj_id( id_type id, code_type code )
+    {
+      return id + graph_type::unzigzag( code );
+    }
+
+    /**
+     *  @brief  Decode the type of the link to the adjacent node from an edge entry.
+     */
+    constexpr static inline linktype_type
+    decode_adj_linktype( code_type )
+    {
+      return base_type::get_default_linktype();
+    }
+  };  /* --- end of template class DirectedGraphTrait --- */
+
   template< typename TSpec,
             typename TDir = Bidirected,
             typename TCoordSpec = void,
@@ -903,6 +1485,14 @@ namespace gum {
     /* === LIFECYCLE === */
     Node( sequence_type s="", string_type n="" )  /* constructor */
       : sequence( std::move( s ) ), name( std::move( n ) ) { }
+
+    /** @brief Convert a node with different sequence or name types (e.g. a view). */
+    template< typename TSequence2, typename TString2,
+              typename = std::enable_if_t< !std::is_same< Node< TSequence2, TString2 >, Node >::value &&
+                                           std::is_constructible< sequence_type, TSequence2 const& >::value &&
+                                           std::is_constructible< string_type, TString2 const& >::value > >
+    Node( Node< TSequence2, TString2 > const& other )
+      : sequence( other.sequence ), name( other.name ) { }
     /* === DATA MEMBERS === */
     sequence_type sequence;
     string_type name;
@@ -1014,17 +1604,33 @@ namespace gum {
     using string_type = typename trait_type::string_type;
     using node_type = Node< sequence_type, string_type >;
     using value_type = node_type;
-    using container_type = std::vector< value_type >;
-    using const_container_type = const std::vector< value_type >;
-    using size_type = typename container_type::size_type;
-    using const_reference = typename container_type::const_reference;
-    using const_iterator = typename container_type::const_iterator;
+    using seq_const_reference = std::string_view;
+    using const_reference = Node< seq_const_reference, std::string_view >;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    /**
+     *  @brief  Location of the sequence and name of a node in the character arena.
+     *
+     *  The name is stored right after the sequence in the same chunk.
+     */
+    struct Record {
+      uint32_t chunk;
+      uint32_t offset;
+      uint32_t seq_len;
+      uint32_t name_len;
+    };
+    using record_type = Record;
+    using records_type = std::vector< record_type >;
+    using chunk_type = std::vector< char >;
+    using chunks_type = std::vector< chunk_type >;
+    /** @brief Minimum capacity of arena chunks in bytes. */
+    constexpr static std::size_t CHUNK_CAPACITY = 1 << 20;
 
     template< typename TNodeProp >
-    using const_sequence_proxy_container = SequenceProxyContainer< std::add_const_t< TNodeProp >, const_container_type >;
+    using const_sequence_proxy_container = SequenceProxyContainer< std::add_const_t< TNodeProp >, std::add_const_t< TNodeProp > >;
 
     template< typename TNodeProp >
-    using const_name_proxy_container = NameProxyContainer< std::add_const_t< TNodeProp >, const_container_type >;
+    using const_name_proxy_container = NameProxyContainer< std::add_const_t< TNodeProp >, std::add_const_t< TNodeProp > >;
   };  /* --- end of template class NodePropertyTrait --- */
 
   template< uint8_t ...TWidths >
@@ -1073,6 +1679,12 @@ namespace gum {
       /* === LIFECYCLE === */
       Edge( offset_type overlap_=0 )    /* constructor */
         : overlap( overlap_ ) { }
+      /* === METHODS === */
+      inline bool
+      is_default( ) const
+      {
+        return this->overlap == 0;
+      }
       /* === DATA MEMBERS === */
       offset_type overlap;
     };  /* --- end of class Edge --- */
@@ -1089,6 +1701,16 @@ namespace gum {
       // `dense_hash_map` requires to set empty key before any `insert` call.
       //c.set_empty_key( trait_type::get_dummy_link( ) );
     }
+
+    /**
+     *  @brief  The property of the edges which are not stored explicitly.
+     */
+    static inline value_type const&
+    default_value( )
+    {
+      static const value_type value{};
+      return value;
+    }
   };  /* --- end of template class EdgePropertyTrait --- */
 
   template< typename TSpec, typename TDir, uint8_t ...TWidths >
@@ -1220,6 +1842,33 @@ namespace gum {
         }
       }
 
+      /**
+       *  @brief  Remove the step at position `pos`.
+       *
+       *  The steps after `pos` are shifted back by one position.
+       */
+      inline void
+      remove_node( size_type pos )
+      {
+        assert( pos < this->nodes.size() );
+        this->nodes.erase( this->nodes.begin() + pos );
+      }
+
+      /**
+       *  @brief  Drop the steps on nodes for which `removed` is true.
+       */
+      template< typename TPredicate >
+      inline void
+      compact( TPredicate removed )
+      {
+        this->nodes.erase(
+            std::remove_if( this->nodes.begin(), this->nodes.end(),
+                            [&removed]( value_type value ) {
+                              return removed( base_type::id_of( value ) );
+                            } ),
+            this->nodes.end() );
+      }
+
       inline const_iterator
       begin( ) const
       {
@@ -1270,6 +1919,12 @@ namespace gum {
         this->nodes.clear();
       }
 
+      inline void
+      reserve( size_type size )
+      {
+        this->nodes.reserve( size );
+      }
+
       inline void
       shrink_to_fit( )
       {
@@ -1518,6 +2173,14 @@ namespace gum {
 
   template< typename TObject, typename ...TArgs >
   using make_succinct_t = typename make_succinct< TObject, TArgs... >::type;
+
+  template< typename TObject, typename ...TArgs >
+  struct make_compressed {
+    using type = typename TObject::template compressed_template< TArgs... >;
+  };  /* --- end of template struct make_compressed --- */
+
+  template< typename TObject, typename ...TArgs >
+  using make_compressed_t = typename make_compressed< TObject, TArgs... >::type;
 }  /* --- end of namespace gum --- */
 
 #endif  /* --- #ifndef GUM_SEQGRAPH_BASE_HPP__ --- */
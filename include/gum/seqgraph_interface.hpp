@@ -19,8 +19,19 @@
 #define  GUM_SEQGRAPH_INTERFACE_HPP__
 
 #include <vector>
+#include <functional>
 #include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
 #include <queue>
+#include <limits>
+#include <variant>
+#include <cmath>
+#include <atomic>
+#include <string>
+#include <ostream>
+#include <iterator>
 
 #include <sdsl/bit_vectors.hpp>
 
@@ -268,11 +279,17 @@ namespace gum {
       static_assert( std::is_invocable_v< TCallback2, rank_type, id_type >, "received a non-invocable as callback" );
       static_assert( std::is_invocable_v< TCallback3, rank_type, id_type, bool >, "received a non-invocable as callback" );
 
-      auto n = graph.get_node_count();
+      auto n = graph.get_max_rank();
 
       nodes_type stack;
       map_type visited( 2*n+1, 0 );  // visited[rank*2] <- discovered | visited[rank*2-1] <- finished
       visited[0] = 1;  // dummy
+      if ( n != graph.get_node_count() ) {
+        // Ranks of removed nodes in a non-compact graph are never visited.
+        for ( rank_type rank = 1; rank <= n; ++rank ) {
+          if ( graph.rank_to_id( rank ) == 0 ) visited[ rank * 2 ] = visited[ rank * 2 - 1 ] = 1;
+        }
+      }
 
       for_each_start_side(
           graph,
@@ -313,9 +330,108 @@ namespace gum {
       } while ( true );
     }
 
+    /**
+     *  @brief  Compute a topological order of the nodes by level-synchronous Kahn's algorithm
+     *
+     *  The first level consists of the nodes without incoming edges, and each following
+     *  level of the nodes whose in-degree drops to zero when the previous level is removed.
+     *  Large levels are expanded in parallel using atomic in-degree counters and per-thread
+     *  frontiers. Each level is sorted by rank, so the order does not depend on the number
+     *  of threads. If the graph has a cycle, the nodes on or reachable from it never reach
+     *  zero in-degree and are missing from the returned order.
+     *
+     *  @param  graph The graph.
+     *  @return The nodes in topological order and whether all nodes have been ordered;
+     *          i.e. whether the graph is a DAG.
+     */
     template< typename TGraph >
     inline std::pair< std::vector< std::pair< typename TGraph::rank_type, typename TGraph::id_type > >, bool >
-    topological_sort_order( TGraph const& graph, bool reverse=false )
+    kahn_topological_order( TGraph const& graph )
+    {
+      using graph_type = TGraph;
+      using rank_type = typename graph_type::rank_type;
+      using id_type = typename graph_type::id_type;
+      using linktype_type = typename graph_type::linktype_type;
+      using value_type = std::pair< rank_type, id_type >;
+      using nodes_type = std::vector< value_type >;
+
+      /* Levels smaller than this are not worth the cost of a parallel region */
+      constexpr const std::size_t PAR_THRESHOLD = 1024;
+
+      nodes_type nodes;
+      nodes.reserve( graph.get_node_count() );
+      graph.for_each_node(
+          [&nodes]( rank_type rank, id_type id ) {
+            nodes.push_back( { rank, id } );
+            return true;
+          } );
+
+      nodes_type order;
+      order.reserve( nodes.size() );
+      if ( nodes.empty() ) return { order, true };
+
+      std::vector< rank_type > indegrees( nodes.back().first, 0 );
+      #pragma omp parallel for schedule( dynamic, 1024 )
+      for ( std::size_t i = 0; i < nodes.size(); ++i ) {
+        graph.for_each_edges_out(
+            nodes[ i ].second,
+            [&graph, &indegrees]( id_type to, linktype_type ) {
+              auto& indegree = indegrees[ graph.id_to_rank( to ) - 1 ];
+              #pragma omp atomic
+              ++indegree;
+              return true;
+            } );
+      }
+
+      nodes_type frontier;
+      for ( auto const& node : nodes ) {
+        if ( indegrees[ node.first - 1 ] == 0 ) frontier.push_back( node );
+      }
+
+      nodes_type next;
+      auto expand =
+          [&graph, &indegrees]( value_type const& node, nodes_type& out ) {
+            graph.for_each_edges_out(
+                node.second,
+                [&graph, &indegrees, &out]( id_type to, linktype_type ) {
+                  auto rank = graph.id_to_rank( to );
+                  rank_type left;
+                  #pragma omp atomic capture
+                  left = --indegrees[ rank - 1 ];
+                  if ( left == 0 ) out.push_back( { rank, to } );
+                  return true;
+                } );
+          };
+
+      while ( !frontier.empty() ) {
+        order.insert( order.end(), frontier.begin(), frontier.end() );
+        next.clear();
+        if ( frontier.size() < PAR_THRESHOLD ) {
+          for ( auto const& node : frontier ) expand( node, next );
+        }
+        else {
+          #pragma omp parallel
+          {
+            nodes_type local;
+            #pragma omp for schedule( dynamic, 256 ) nowait
+            for ( std::size_t i = 0; i < frontier.size(); ++i ) {
+              expand( frontier[ i ], local );
+            }
+            #pragma omp critical
+            next.insert( next.end(), local.begin(), local.end() );
+          }
+        }
+        std::sort( next.begin(), next.end() );
+        frontier.swap( next );
+      }
+
+      bool dag = ( order.size() == nodes.size() );
+      return { order, dag };
+    }
+
+    template< typename TGraph >
+    inline std::pair< std::vector< std::pair< typename TGraph::rank_type, typename TGraph::id_type > >, bool >
+    _dfs_topological_sort_order( TGraph const& graph, bool reverse=false )
     {
       using graph_type = TGraph;
       using rank_type = typename graph_type::rank_type;
@@ -339,6 +455,27 @@ namespace gum {
       return { finished, dag };
     }
 
+    /**
+     *  @brief  Compute a topological order of the nodes
+     *
+     *  The order is computed by `kahn_topological_order`. For cyclic graphs, it falls back
+     *  to DFS finishing times which gives an order for all nodes in which only the back
+     *  edges point backward.
+     *
+     *  @param  graph The graph.
+     *  @param  reverse Whether to return the reverse of the order.
+     *  @return The nodes in topological order and whether the graph is a DAG.
+     */
+    template< typename TGraph >
+    inline std::pair< std::vector< std::pair< typename TGraph::rank_type, typename TGraph::id_type > >, bool >
+    topological_sort_order( TGraph const& graph, bool reverse=false )
+    {
+      auto result = kahn_topological_order( graph );
+      if ( !result.second ) return _dfs_topological_sort_order( graph, reverse );
+      if ( reverse ) std::reverse( result.first.begin(), result.first.end() );
+      return result;
+    }
+
     template< typename TGraph,
               typename=std::enable_if_t< std::is_same< typename TGraph::spec_type, Dynamic >::value > >
     inline bool
@@ -378,7 +515,7 @@ namespace gum {
       static_assert( std::is_invocable_v< TCompare, value_type, value_type >, "received a non-invocable as callback" );
       static_assert( std::is_invocable_v< TCallback2, rank_type, id_type, rank_type >, "received a non-invocable as callback" );
 
-      auto n = graph.get_node_count();
+      auto n = graph.get_max_rank();
 
       std::priority_queue< value_type, nodes_type, decltype(degree_cmp) > queue{ degree_cmp };
       map_type visited( n + 1, 0 );
@@ -413,38 +550,704 @@ namespace gum {
           } );
     }
 
+    /**
+     *  @brief  Call a callback on the oriented successors of an oriented node.
+     *
+     *  A walk in a bidirected graph enters a node through one side and leaves it through
+     *  the other. So an oriented node (handle) is represented here by the side through
+     *  which walks leave it: `end_side( id )` is the node in forward orientation and
+     *  `start_side( id )` in reverse. The successors are the nodes entered through the
+     *  edges at that side, whether stored as outgoing or incoming edges. Each is given
+     *  by the opposite side of the one entered.
+     *
+     *  @param  graph The bidirected graph.
+     *  @param  side The oriented node.
+     *  @param  callback A function taking a successor and returning `false` to stop.
+     *  @return `true` if it has iterated over all successors, and `false` if the
+     *  iteration has been interrupted by `callback`.
+     */
+    template< typename TGraph, typename TCallback >
+    inline bool
+    for_each_oriented_successor( TGraph const& graph, typename TGraph::side_type side,
+                                 TCallback callback )
+    {
+      using side_type = typename TGraph::side_type;
+
+      static_assert( std::is_same< typename TGraph::dir_type, Bidirected >::value,
+                     "oriented nodes are only defined for bidirected graphs" );
+      static_assert( std::is_invocable_r_v< bool, TCallback, side_type >, "received a non-invocable as callback" );
+
+      auto leave = [&graph, &callback]( side_type entered ) {
+        return callback( graph.opposite_side( entered ) );
+      };
+      return graph.for_each_edges_out( side, leave ) && graph.for_each_edges_in( side, leave );
+    }
+
+    /**
+     *  @brief  Index of an oriented node in a packed map with two bits per node.
+     *
+     *  The bits of node `rank` are `2 * ( rank - 1 )` for the reverse and the next one
+     *  for the forward orientation.
+     */
     template< typename TGraph >
-    inline std::vector< std::pair< typename TGraph::rank_type, typename TGraph::id_type > >
-    cuthill_mckee_order( TGraph& graph, bool reverse=true )
+    inline typename TGraph::rank_type
+    oriented_index( TGraph const& graph, typename TGraph::side_type side )
+    {
+      return 2 * ( graph.id_to_rank( graph.id_of( side ) ) - 1 ) + side.second;
+    }
+
+    /**
+     *  @brief  Breadth-first traversal over oriented nodes.
+     *
+     *  Visited oriented nodes are marked in a bit vector with two bits per node (see
+     *  `oriented_index`), so a node can be visited in each orientation once.
+     *
+     *  @param  graph The bidirected graph.
+     *  @param  starts The oriented nodes to start from, at level zero.
+     *  @param  callback A function taking an oriented node and its level, and returning
+     *          whether its successors should be traversed.
+     */
+    template< typename TGraph, typename TContainer, typename TCallback >
+    inline void
+    oriented_bfs_traverse( TGraph const& graph, TContainer const& starts, TCallback callback )
     {
-      using id_type = typename TGraph::id_type;
       using rank_type = typename TGraph::rank_type;
+      using side_type = typename TGraph::side_type;
+
+      static_assert( std::is_invocable_r_v< bool, TCallback, side_type, rank_type >, "received a non-invocable as callback" );
+
+      sdsl::bit_vector visited( 2 * graph.get_max_rank(), 0 );
+      std::vector< std::pair< side_type, rank_type > > queue;
+      for ( side_type side : starts ) {
+        auto idx = oriented_index( graph, side );
+        if ( visited[ idx ] ) continue;
+        visited[ idx ] = 1;
+        queue.push_back( { side, 0 } );
+      }
+
+      for ( std::size_t i = 0; i < queue.size(); ++i ) {
+        auto [ side, level ] = queue[ i ];
+        if ( !callback( side, level ) ) continue;
+        for_each_oriented_successor(
+            graph, side,
+            [&graph, &visited, &queue, level=level]( side_type next ) {
+              auto idx = oriented_index( graph, next );
+              if ( !visited[ idx ] ) {
+                visited[ idx ] = 1;
+                queue.push_back( { next, level + 1 } );
+              }
+              return true;
+            } );
+      }
+    }
+
+    /**
+     *  @brief  Depth-first traversal over oriented nodes.
+     *
+     *  The traversal is iterative. It keeps the DFS path and the successors of its
+     *  oriented nodes on the heap, and marks visited oriented nodes in a bit vector with
+     *  two bits per node (see `oriented_index`). Oriented nodes not reachable from
+     *  `starts` are not visited.
+     *
+     *  @param  graph The bidirected graph.
+     *  @param  starts The oriented nodes to start from, in order.
+     *  @param  on_finishing A function called on an oriented node once all its
+     *          successors are finished.
+     *  @param  on_discovery A function called on an oriented node when it is discovered.
+     */
+    template< typename TGraph, typename TContainer, typename TCallback1,
+              typename TCallback2 = void(*)( typename TGraph::side_type ) >
+    inline void
+    oriented_dfs_traverse( TGraph const& graph, TContainer const& starts,
+                           TCallback1 on_finishing,
+                           TCallback2 on_discovery = []( auto ){} )
+    {
+      using side_type = typename TGraph::side_type;
+
+      static_assert( std::is_invocable_v< TCallback1, side_type >, "received a non-invocable as callback" );
+      static_assert( std::is_invocable_v< TCallback2, side_type >, "received a non-invocable as callback" );
+
+      sdsl::bit_vector visited( 2 * graph.get_max_rank(), 0 );
+      std::vector< side_type > successors;
+      std::vector< std::tuple< side_type, std::size_t, std::size_t > > path;  // side, first and next successor
+
+      auto discover =
+          [&]( side_type side ) {
+            visited[ oriented_index( graph, side ) ] = 1;
+            std::invoke( on_discovery, side );
+            std::size_t begin = successors.size();
+            for_each_oriented_successor(
+                graph, side,
+                [&successors]( side_type next ) {
+                  successors.push_back( next );
+                  return true;
+                } );
+            path.push_back( { side, begin, begin } );
+          };
+
+      for ( side_type start : starts ) {
+        if ( visited[ oriented_index( graph, start ) ] ) continue;
+        discover( start );
+        while ( !path.empty() ) {
+          // The successors of the last oriented node on the path are at the end.
+          auto& [ side, begin, next ] = path.back();
+          if ( next < successors.size() ) {
+            side_type succ = successors[ next++ ];
+            if ( !visited[ oriented_index( graph, succ ) ] ) discover( succ );
+            continue;
+          }
+          std::invoke( on_finishing, side );
+          successors.resize( begin );
+          path.pop_back();
+        }
+      }
+    }
+
+    /**
+     *  @brief  Compute BFS levels of all nodes from a set of source nodes.
+     *
+     *  The search is level-synchronous and direction-optimizing. A level is expanded
+     *  top-down from the frontier, or bottom-up by letting each unvisited node look for
+     *  an in-neighbour in the frontier. The search switches to bottom-up when the number
+     *  of edges out of the frontier exceeds 1/`ALPHA` of the in-edges of unvisited nodes.
+     *  It switches back when the frontier shrinks below 1/`BETA` of the nodes. Bottom-up
+     *  steps need incoming edges. They are skipped for `Succinct` graphs that store only
+     *  outgoing edges and have no in-edges index. Levels are expanded in parallel, and
+     *  nodes are claimed with atomic updates of the visited bit vector.
+     *
+     *  @param  graph The graph.
+     *  @param  sources Source node IDs; i.e. the nodes at level zero.
+     *  @return The level of each node by rank, i.e. `levels[ rank - 1 ]`, up to the
+     *          maximum rank (see `get_max_rank`). Nodes not reachable from any source,
+     *          and ranks of removed nodes in a non-compact graph, get
+     *          `std::numeric_limits< rank_type >::max()`.
+     */
+    template< typename TGraph, typename TContainer >
+    inline std::vector< typename TGraph::rank_type >
+    bfs_levels( TGraph const& graph, TContainer const& sources )
+    {
+      using graph_type = TGraph;
+      using id_type = typename graph_type::id_type;
+      using rank_type = typename graph_type::rank_type;
+      using linktype_type = typename graph_type::linktype_type;
       using value_type = std::pair< rank_type, id_type >;
       using nodes_type = std::vector< value_type >;
+      using map_type = sdsl::bit_vector;
+      using word_type = uint64_t;
+
+      constexpr const rank_type UNREACHED = std::numeric_limits< rank_type >::max();
+      constexpr const std::size_t PAR_THRESHOLD = 1024;
+      constexpr const rank_type ALPHA = 14;
+      constexpr const rank_type BETA = 24;
+
+      rank_type n = graph.get_max_rank();
+      std::vector< rank_type > levels( n, UNREACHED );
+
+      bool has_in = true;
+      if constexpr ( std::is_same< typename graph_type::spec_type, Succinct >::value ) {
+        has_in = graph.has_in_index();
+      }
+
+      map_type visited( n, 0 );  // visited[ rank - 1 ]
+      map_type current;          // frontier of the bottom-up steps
+      word_type* words = visited.data();
+      if ( n != graph.get_node_count() ) {
+        // Ranks of removed nodes in a non-compact graph are never visited.
+        for ( rank_type rank = 1; rank <= n; ++rank ) {
+          if ( graph.rank_to_id( rank ) == 0 ) visited[ rank - 1 ] = 1;
+        }
+      }
+
+      auto is_visited =
+          [words]( rank_type rank ) -> bool {
+            word_type word;
+            #pragma omp atomic read
+            word = words[ ( rank - 1 ) >> 6 ];
+            return word & ( word_type( 1 ) << ( ( rank - 1 ) & 63 ) );
+          };
+      /* Mark `rank` as visited; return false if it had been already marked */
+      auto visit =
+          [words, &is_visited]( rank_type rank ) -> bool {
+            if ( is_visited( rank ) ) return false;
+            word_type mask = word_type( 1 ) << ( ( rank - 1 ) & 63 );
+            word_type& word = words[ ( rank - 1 ) >> 6 ];
+            word_type old;
+            #pragma omp atomic capture
+            { old = word; word |= mask; }
+            return !( old & mask );
+          };
+
+      nodes_type frontier;
+      rank_type frontier_edges = 0;
+      rank_type unexplored_edges = graph.get_edge_count();
+      for ( id_type id : sources ) {
+        rank_type rank = graph.id_to_rank( id );
+        if ( !visit( rank ) ) continue;
+        levels[ rank - 1 ] = 0;
+        frontier.push_back( { rank, id } );
+        frontier_edges += graph.outdegree( id );
+        if ( has_in ) unexplored_edges -= std::min( unexplored_edges, graph.indegree( id ) );
+      }
+
+      nodes_type next;
+      bool bottom_up = false;
+      for ( rank_type level = 1; !frontier.empty(); ++level ) {
+        if ( has_in ) {
+          if ( !bottom_up ) bottom_up = frontier_edges > unexplored_edges / ALPHA;
+          else bottom_up = frontier.size() >= n / BETA;
+        }
+
+        next.clear();
+        rank_type next_edges = 0;
+        rank_type next_indegrees = 0;
+        if ( bottom_up ) {
+          current = map_type( n, 0 );
+          for ( auto const& node : frontier ) current[ node.first - 1 ] = 1;
+          #pragma omp parallel
+          {
+            nodes_type local;
+            #pragma omp for schedule( dynamic, 1024 ) reduction( +:next_edges, next_indegrees ) nowait
+            for ( rank_type rank = 1; rank <= n; ++rank ) {
+              if ( is_visited( rank ) ) continue;
+              id_type id = graph.rank_to_id( rank );
+              bool found = !graph.for_each_edges_in(
+                  id,
+                  [&graph, &current]( id_type from, linktype_type ) {
+                    return !current[ graph.id_to_rank( from ) - 1 ];
+                  } );
+              if ( !found ) continue;
+              visit( rank );
+              levels[ rank - 1 ] = level;
+              local.push_back( { rank, id } );
+              next_edges += graph.outdegree( id );
+              next_indegrees += graph.indegree( id );
+            }
+            #pragma omp critical
+            next.insert( next.end(), local.begin(), local.end() );
+          }
+        }
+        else {
+          #pragma omp parallel if( frontier.size() >= PAR_THRESHOLD )
+          {
+            nodes_type local;
+            #pragma omp for schedule( dynamic, 256 ) reduction( +:next_edges, next_indegrees ) nowait
+            for ( std::size_t i = 0; i < frontier.size(); ++i ) {
+              graph.for_each_edges_out(
+                  frontier[ i ].second,
+                  [&]( id_type to, linktype_type ) {
+                    rank_type rank = graph.id_to_rank( to );
+                    if ( !visit( rank ) ) return true;
+                    levels[ rank - 1 ] = level;
+                    local.push_back( { rank, to } );
+                    next_edges += graph.outdegree( to );
+                    if ( has_in ) next_indegrees += graph.indegree( to );
+                    return true;
+                  } );
+            }
+            #pragma omp critical
+            next.insert( next.end(), local.begin(), local.end() );
+          }
+        }
+
+        frontier.swap( next );
+        frontier_edges = next_edges;
+        unexplored_edges -= std::min( unexplored_edges, next_indegrees );
+      }
+
+      return levels;
+    }
+
+    /**
+     *  @brief  Find the nodes within a number of hops from each source node.
+     *
+     *  Bit-parallel multi-source BFS. Sources are processed in batches of 64 *
+     *  `TWords`. Each node keeps `TWords` words of seen, visit and next-visit bits,
+     *  one bit per source in the batch. So a single traversal serves the whole batch,
+     *  and nodes shared by the neighbourhoods of several sources are expanded once per
+     *  level. Levels are expanded in parallel over outgoing edges, and the next-visit
+     *  words are updated atomically. The per-node words are indexed by rank up to the
+     *  maximum rank; so removed nodes of a non-compact graph are simply skipped.
+     *
+     *  @param  graph The graph.
+     *  @param  sources Source node IDs.
+     *  @param  max_level Maximum number of hops from a source.
+     *  @return The IDs of the nodes within `max_level` hops from `sources[ i ]` at
+     *          index `i`, ordered by rank. Each includes the source itself.
+     */
+    template< unsigned int TWords = 1, typename TGraph, typename TContainer >
+    inline std::vector< std::vector< typename TGraph::id_type > >
+    multi_source_bfs( TGraph const& graph, TContainer const& sources,
+                      typename TGraph::rank_type max_level )
+    {
+      using graph_type = TGraph;
+      using id_type = typename graph_type::id_type;
+      using rank_type = typename graph_type::rank_type;
+      using linktype_type = typename graph_type::linktype_type;
+      using word_type = uint64_t;
+      using words_type = std::vector< word_type >;
+      using ranks_type = std::vector< rank_type >;
+
+      static_assert( TWords > 0, "batches should have at least one word" );
+
+      constexpr const std::size_t BATCH = 64 * TWords;
+      constexpr const std::size_t PAR_THRESHOLD = 256;
+
+      rank_type n = graph.get_max_rank();
+      std::vector< id_type > source_ids( sources.begin(), sources.end() );
+      std::vector< std::vector< id_type > > result( source_ids.size() );
+
+      words_type seen( n * TWords, 0 );
+      words_type visit( n * TWords, 0 );
+      words_type visit_next( n * TWords, 0 );
+      std::vector< char > queued( n, 0 );
+
+      auto at = []( rank_type rank, unsigned int w ) { return ( rank - 1 ) * TWords + w; };
+      auto expand =
+          [&]( rank_type from, ranks_type& out ) {
+            graph.for_each_edges_out(
+                graph.rank_to_id( from ),
+                [&]( id_type to, linktype_type ) {
+                  rank_type rank = graph.id_to_rank( to );
+                  bool updated = false;
+                  for ( unsigned int w = 0; w < TWords; ++w ) {
+                    word_type diff = visit[ at( from, w ) ] & ~seen[ at( rank, w ) ];
+                    if ( !diff ) continue;
+                    word_type& word = visit_next[ at( rank, w ) ];
+                    #pragma omp atomic
+                    word |= diff;
+                    updated = true;
+                  }
+                  if ( !updated ) return true;
+                  char old;
+                  #pragma omp atomic capture
+                  { old = queued[ rank - 1 ]; queued[ rank - 1 ] = 1; }
+                  if ( !old ) out.push_back( rank );
+                  return true;
+                } );
+          };
+
+      for ( std::size_t begin = 0; begin < source_ids.size(); begin += BATCH ) {
+        std::size_t end = std::min( begin + BATCH, source_ids.size() );
+
+        ranks_type frontier;
+        for ( std::size_t i = begin; i < end; ++i ) {
+          rank_type rank = graph.id_to_rank( source_ids[ i ] );
+          word_type mask = word_type( 1 ) << ( ( i - begin ) % 64 );
+          seen[ at( rank, ( i - begin ) / 64 ) ] |= mask;
+          visit[ at( rank, ( i - begin ) / 64 ) ] |= mask;
+          if ( !queued[ rank - 1 ] ) {
+            queued[ rank - 1 ] = 1;
+            frontier.push_back( rank );
+          }
+        }
+        for ( auto rank : frontier ) queued[ rank - 1 ] = 0;
+        ranks_type touched( frontier );
+
+        ranks_type next;
+        for ( rank_type level = 0; level < max_level && !frontier.empty(); ++level ) {
+          next.clear();
+          #pragma omp parallel if( frontier.size() >= PAR_THRESHOLD )
+          {
+            ranks_type local;
+            #pragma omp for schedule( dynamic, 64 ) nowait
+            for ( std::size_t i = 0; i < frontier.size(); ++i ) expand( frontier[ i ], local );
+            #pragma omp critical
+            next.insert( next.end(), local.begin(), local.end() );
+          }
+
+          for ( auto rank : frontier ) {
+            for ( unsigned int w = 0; w < TWords; ++w ) visit[ at( rank, w ) ] = 0;
+          }
+          for ( auto rank : next ) {
+            for ( unsigned int w = 0; w < TWords; ++w ) {
+              seen[ at( rank, w ) ] |= visit_next[ at( rank, w ) ];
+              visit[ at( rank, w ) ] = visit_next[ at( rank, w ) ];
+              visit_next[ at( rank, w ) ] = 0;
+            }
+            queued[ rank - 1 ] = 0;
+          }
+          touched.insert( touched.end(), next.begin(), next.end() );
+          frontier.swap( next );
+        }
+        for ( auto rank : frontier ) {
+          for ( unsigned int w = 0; w < TWords; ++w ) visit[ at( rank, w ) ] = 0;
+        }
+
+        std::sort( touched.begin(), touched.end() );
+        touched.erase( std::unique( touched.begin(), touched.end() ), touched.end() );
+        for ( auto rank : touched ) {
+          id_type id = graph.rank_to_id( rank );
+          for ( unsigned int w = 0; w < TWords; ++w ) {
+            for ( word_type word = seen[ at( rank, w ) ]; word; word &= word - 1 ) {
+              result[ begin + w * 64 + sdsl::bits::lo( word ) ].push_back( id );
+            }
+            seen[ at( rank, w ) ] = 0;
+          }
+        }
+      }
+
+      return result;
+    }
+
+    /**
+     *  @brief  Get the adjacency lists of all nodes regardless of the edge directions.
+     *
+     *  The graph should be compact (see `DirectedGraph< Dynamic >::compact`);
+     *  otherwise, an exception is thrown.
+     *
+     *  @return Offsets and neighbour ranks in compressed sparse row format; i.e. the
+     *          neighbours of the node at `rank` are in `[ offsets[ rank - 1 ], offsets[ rank ] )`.
+     */
+    template< typename TGraph >
+    inline std::pair< std::vector< typename TGraph::rank_type >, std::vector< typename TGraph::rank_type > >
+    _undirected_adjacency( TGraph const& graph )
+    {
+      using id_type = typename TGraph::id_type;
+      using rank_type = typename TGraph::rank_type;
+      using linktype_type = typename TGraph::linktype_type;
+
+      if ( graph.get_max_rank() != graph.get_node_count() ) {
+        throw std::runtime_error( "node orders require a compact graph" );
+      }
 
-      nodes_type result;
-      result.reserve( graph.get_node_count() );
+      rank_type n = graph.get_node_count();
+      std::vector< rank_type > offsets( n + 1, 0 );
+      std::vector< rank_type > adjacents;
+      adjacents.reserve( 2 * graph.get_edge_count() );
 
-      auto on_finishing = [&result]( rank_type rank, id_type id ) {
-        result.push_back( { rank, id } );
+      auto add = [&graph, &adjacents]( id_type other, linktype_type ) {
+        adjacents.push_back( graph.id_to_rank( other ) );
+        return true;
       };
+      for ( rank_type rank = 1; rank <= n; ++rank ) {
+        id_type id = graph.rank_to_id( rank );
+        graph.for_each_edges_out( id, add );
+        graph.for_each_edges_in( id, add );
+        offsets[ rank ] = adjacents.size();
+      }
+      return { offsets, adjacents };
+    }
+
+    /**
+     *  @brief  Get the breadth-first order of nodes regardless of the edge directions.
+     *
+     *  Each component is traversed from its node with the lowest rank. The neighbours
+     *  of a node are enqueued in the order of its adjacency lists. The graph should
+     *  be compact; otherwise, an exception is thrown.
+     */
+    template< typename TGraph >
+    inline std::vector< std::pair< typename TGraph::rank_type, typename TGraph::id_type > >
+    bfs_order( TGraph const& graph )
+    {
+      using id_type = typename TGraph::id_type;
+      using rank_type = typename TGraph::rank_type;
+      using value_type = std::pair< rank_type, id_type >;
+
+      auto [ offsets, adjacents ] = _undirected_adjacency( graph );
+      rank_type n = graph.get_node_count();
+
+      std::vector< rank_type > queue;
+      queue.reserve( n );
+      sdsl::bit_vector visited( n + 1, 0 );
+      visited[ 0 ] = 1;  // dummy
+      for ( rank_type seed = 1; seed <= n; ++seed ) {
+        if ( visited[ seed ] ) continue;
+        visited[ seed ] = 1;
+        queue.push_back( seed );
+        for ( std::size_t i = queue.size() - 1; i < queue.size(); ++i ) {
+          for ( auto j = offsets[ queue[ i ] - 1 ]; j < offsets[ queue[ i ] ]; ++j ) {
+            rank_type next = adjacents[ j ];
+            if ( visited[ next ] ) continue;
+            visited[ next ] = 1;
+            queue.push_back( next );
+          }
+        }
+      }
+
+      std::vector< value_type > result;
+      result.reserve( n );
+      for ( auto rank : queue ) result.push_back( { rank, graph.rank_to_id( rank ) } );
+      return result;
+    }
+
+    /**
+     *  @brief  Get the (reverse) Cuthill-McKee order of nodes.
+     *
+     *  Nodes are traversed breadth-first regardless of the edge directions. Unvisited
+     *  neighbours of each node are enqueued in ascending order of their degrees. Each
+     *  component is traversed from its first start side or, if it has none, from its
+     *  node with the lowest rank. The graph should be compact; otherwise, an exception
+     *  is thrown.
+     *
+     *  @param  graph The graph.
+     *  @param  reverse Whether to return the reverse order; i.e. reverse Cuthill-McKee.
+     */
+    template< typename TGraph >
+    inline std::vector< std::pair< typename TGraph::rank_type, typename TGraph::id_type > >
+    cuthill_mckee_order( TGraph const& graph, bool reverse=true )
+    {
+      using id_type = typename TGraph::id_type;
+      using rank_type = typename TGraph::rank_type;
+      using value_type = std::pair< rank_type, id_type >;
+
+      auto [ offsets, adjacents ] = _undirected_adjacency( graph );
+      rank_type n = graph.get_node_count();
+
+      std::vector< rank_type > seeds;
+      for_each_start_side(
+          graph,
+          [&seeds]( rank_type rank, id_type ) {
+            seeds.push_back( rank );
+            return true;
+          } );
+      for ( rank_type rank = 1; rank <= n; ++rank ) seeds.push_back( rank );
+
+      std::vector< rank_type > queue;
+      queue.reserve( n );
+      sdsl::bit_vector visited( n + 1, 0 );
+      visited[ 0 ] = 1;  // dummy
+      for ( auto seed : seeds ) {
+        if ( visited[ seed ] ) continue;
+        visited[ seed ] = 1;
+        queue.push_back( seed );
+        for ( std::size_t i = queue.size() - 1; i < queue.size(); ++i ) {
+          auto begin = queue.size();
+          for ( auto j = offsets[ queue[ i ] - 1 ]; j < offsets[ queue[ i ] ]; ++j ) {
+            rank_type next = adjacents[ j ];
+            if ( visited[ next ] ) continue;
+            visited[ next ] = 1;
+            queue.push_back( next );
+          }
+          std::stable_sort( queue.begin() + begin, queue.end(),
+                            [&offsets]( rank_type a, rank_type b ) {
+                              return offsets[ a ] - offsets[ a - 1 ] < offsets[ b ] - offsets[ b - 1 ];
+                            } );
+        }
+      }
+      if ( reverse ) std::reverse( queue.begin(), queue.end() );
+
+      std::vector< value_type > result;
+      result.reserve( n );
+      for ( auto rank : queue ) result.push_back( { rank, graph.rank_to_id( rank ) } );
+      return result;
+    }
+
+    /**
+     *  @brief  Get a node order placing nodes with common neighbourhoods close together.
+     *
+     *  A greedy heuristic in the spirit of Gorder. Nodes are placed one by one. The next
+     *  node is the unplaced one with the highest score with respect to the last `window`
+     *  placed nodes. A node scores one for each adjacent node in the window, and one for
+     *  each neighbour it shares with a node in the window. Shared neighbours with degrees
+     *  above the square root of the node count are ignored to bound the cost of updates.
+     *  Ties are broken by rank. When no unplaced node scores, the one with the lowest
+     *  rank is placed next. The graph should be compact; otherwise, an exception is
+     *  thrown.
+     *
+     *  @param  graph The graph.
+     *  @param  window The number of last placed nodes considered for scoring.
+     */
+    template< typename TGraph >
+    inline std::vector< std::pair< typename TGraph::rank_type, typename TGraph::id_type > >
+    gorder_order( TGraph const& graph, std::size_t window=5 )
+    {
+      using id_type = typename TGraph::id_type;
+      using rank_type = typename TGraph::rank_type;
+      using value_type = std::pair< rank_type, id_type >;
+      using score_type = long long int;
+      using entry_type = std::pair< score_type, rank_type >;
 
-      auto degree_cmp = [&graph]( const auto& a, const auto& b ) {
-        return graph.outdegree( a.second ) > graph.outdegree( b.second );
+      auto adjacency = _undirected_adjacency( graph );
+      auto const& offsets = adjacency.first;
+      auto const& adjacents = adjacency.second;
+      rank_type n = graph.get_node_count();
+      rank_type hub_degree = std::max( rank_type( 16 ), static_cast< rank_type >( std::sqrt( n ) ) );
+
+      std::vector< score_type > scores( n + 1, 0 );
+      sdsl::bit_vector placed( n + 1, 0 );
+      placed[ 0 ] = 1;  // dummy
+
+      auto cmp = []( entry_type const& a, entry_type const& b ) {
+        return a.first < b.first || ( a.first == b.first && a.second > b.second );
       };
+      std::priority_queue< entry_type, std::vector< entry_type >, decltype( cmp ) > heap( cmp );
+
+      auto update =
+          [&]( rank_type rank, score_type delta ) {
+            auto bump = [&]( rank_type other ) {
+              if ( other == rank || placed[ other ] ) return;
+              scores[ other ] += delta;
+              if ( delta > 0 ) heap.push( { scores[ other ], other } );
+            };
+            for ( auto i = offsets[ rank - 1 ]; i < offsets[ rank ]; ++i ) {
+              rank_type adj = adjacents[ i ];
+              bump( adj );
+              if ( offsets[ adj ] - offsets[ adj - 1 ] > hub_degree ) continue;
+              for ( auto j = offsets[ adj - 1 ]; j < offsets[ adj ]; ++j ) bump( adjacents[ j ] );
+            }
+          };
 
-      bfs_traverse( graph, on_finishing, degree_cmp );
-      if ( reverse ) std::reverse( result.begin(), result.end() );
+      std::vector< rank_type > order;
+      order.reserve( n );
+      rank_type next_unplaced = 1;
+      while ( order.size() < n ) {
+        rank_type next = 0;
+        while ( !heap.empty() && next == 0 ) {
+          auto [ score, rank ] = heap.top();
+          heap.pop();
+          if ( placed[ rank ] ) continue;
+          if ( score == scores[ rank ] ) next = rank;
+          // Scores decreased after the entry was pushed, so there might be no entry with the current one.
+          else if ( score > scores[ rank ] && scores[ rank ] > 0 ) heap.push( { scores[ rank ], rank } );
+        }
+        if ( next == 0 ) {
+          while ( placed[ next_unplaced ] ) ++next_unplaced;
+          next = next_unplaced;
+        }
+
+        placed[ next ] = 1;
+        order.push_back( next );
+        update( next, 1 );
+        if ( order.size() > window ) update( order[ order.size() - window - 1 ], -1 );
+      }
 
+      std::vector< value_type > result;
+      result.reserve( n );
+      for ( auto rank : order ) result.push_back( { rank, graph.rank_to_id( rank ) } );
       return result;
     }
 
-    template< typename TGraph,
+    /**
+     *  @brief  Reorder the nodes of a Dynamic graph by a node order.
+     *
+     *  The order is applied lazily (see `sort_nodes( perm, Lazy )`), so node records are
+     *  not moved. A `Succinct` graph constructed afterwards lays out its node records and
+     *  sequences in this order.
+     *
+     *  @param  graph The graph.
+     *  @param  order A permutation of all nodes as given by e.g. `bfs_order`,
+     *          `cuthill_mckee_order` or `gorder_order`.
+     */
+    template< typename TGraph, typename TContainer,
               typename=std::enable_if_t< std::is_same< typename TGraph::spec_type, Dynamic >::value > >
     inline void
-    cuthill_mckee_sort( TGraph& graph, bool reverse=true ) {
-      using graph_type = TGraph;
-      using rank_type = typename graph_type::rank_type;
+    reorder_nodes( TGraph& graph, TContainer const& order )
+    {
+      using rank_type = typename TGraph::rank_type;
+      using value_type = typename TContainer::value_type;
+
+      assert( order.size() == graph.get_node_count() );
+      RandomAccessProxyContainer perm(
+          &order, []( value_type const& p ) -> rank_type { return p.first - 1; } );
+      graph.sort_nodes( perm, Lazy{} );
+    }
+
+    template< typename TGraph,
+              typename=std::enable_if_t< std::is_same< typename TGraph::spec_type, Dynamic >::value > >
+    inline void
+    cuthill_mckee_sort( TGraph& graph, bool reverse=true ) {
+      using graph_type = TGraph;
+      using rank_type = typename graph_type::rank_type;
       using id_type = typename graph_type::id_type;
 
       auto rcm = cuthill_mckee_order( graph, reverse );
@@ -454,6 +1257,895 @@ namespace gum {
           } );
       graph.sort_nodes( perm );
     }
+
+    /**
+     *  @brief  Average distance between the ranks of adjacent nodes.
+     *
+     *  `Succinct` graphs store node records and sequences in rank order. So, a lower
+     *  value means that following an edge is more likely to stay within the cache.
+     *
+     *  @return The average of `|rank( from ) - rank( to )|` over all edges; zero if
+     *          the graph has no edges.
+     */
+    template< typename TGraph >
+    inline double
+    average_edge_span( TGraph const& graph )
+    {
+      using id_type = typename TGraph::id_type;
+      using rank_type = typename TGraph::rank_type;
+      using linktype_type = typename TGraph::linktype_type;
+
+      rank_type n = graph.get_max_rank();
+      double span_sum = 0;
+      rank_type edge_count = 0;
+      #pragma omp parallel for schedule( static ) reduction( +:span_sum, edge_count )
+      for ( rank_type rank = 1; rank <= n; ++rank ) {
+        id_type id = graph.rank_to_id( rank );
+        if ( id == 0 ) continue;  // removed node in a non-compact graph
+        graph.for_each_edges_out(
+            id,
+            [&graph, rank, &span_sum, &edge_count]( id_type to, linktype_type ) {
+              rank_type to_rank = graph.id_to_rank( to );
+              span_sum += ( rank < to_rank ) ? to_rank - rank : rank - to_rank;
+              ++edge_count;
+              return true;
+            } );
+      }
+      return edge_count ? span_sum / edge_count : 0;
+    }
+
+    /**
+     *  @brief  Weakly connected components of a graph and their sizes.
+     *
+     *  Components are numbered in the order of their lowest node ranks.
+     */
+    template< typename TRank, typename TOffset >
+    struct ConnectedComponents {
+      std::vector< TRank > labels;              /**< @brief Component of each node by rank; i.e. `labels[ rank - 1 ]` */
+      std::vector< TRank > first_ranks;         /**< @brief Lowest node rank in each component */
+      std::vector< TRank > node_counts;         /**< @brief Number of nodes in each component */
+      std::vector< TRank > edge_counts;         /**< @brief Number of edges in each component */
+      std::vector< TOffset > sequence_lengths;  /**< @brief Total sequence length of each component */
+
+      inline std::size_t
+      size( ) const
+      {
+        return this->first_ranks.size();
+      }
+    };
+
+    /**
+     *  @brief  Find the weakly connected components of a graph.
+     *
+     *  Edges are merged in parallel into a lock-free union-find structure. Roots are
+     *  always linked under the root with the lower rank, so the representative of each
+     *  component is its lowest-ranked node regardless of the scheduling. The result does
+     *  not depend on node ranks being sorted or on components having start sides.
+     *
+     *  The graph should be compact (see `DirectedGraph< Dynamic >::compact`);
+     *  otherwise, an exception is thrown.
+     *
+     *  @param  graph The sequence graph.
+     *  @return Component labels of the nodes and the per-component node, edge, and
+     *          sequence length counts.
+     */
+    template< typename TGraph >
+    inline ConnectedComponents< typename TGraph::rank_type, typename TGraph::offset_type >
+    connected_components( TGraph const& graph )
+    {
+      using id_type = typename TGraph::id_type;
+      using rank_type = typename TGraph::rank_type;
+      using linktype_type = typename TGraph::linktype_type;
+
+      if ( graph.get_max_rank() != graph.get_node_count() ) {
+        throw std::runtime_error( "connected components require a compact graph" );
+      }
+
+      rank_type n = graph.get_node_count();
+      std::vector< std::atomic< rank_type > > parents( n );  // by `rank - 1`
+
+      auto find =
+          [&parents]( rank_type x ) {
+            while ( true ) {
+              rank_type parent = parents[ x ].load( std::memory_order_relaxed );
+              if ( parent == x ) return x;
+              rank_type grandparent = parents[ parent ].load( std::memory_order_relaxed );
+              // Path halving; it is fine if another thread changed the parent meanwhile.
+              if ( parent != grandparent ) parents[ x ].compare_exchange_weak( parent, grandparent );
+              x = grandparent;
+            }
+          };
+      auto unite =
+          [&parents, &find]( rank_type a, rank_type b ) {
+            while ( true ) {
+              a = find( a );
+              b = find( b );
+              if ( a == b ) return;
+              if ( a < b ) std::swap( a, b );
+              if ( parents[ a ].compare_exchange_strong( a, b ) ) return;
+            }
+          };
+
+      #pragma omp parallel for schedule( static )
+      for ( rank_type i = 0; i < n; ++i ) parents[ i ].store( i, std::memory_order_relaxed );
+
+      #pragma omp parallel for schedule( dynamic, 1024 )
+      for ( rank_type i = 0; i < n; ++i ) {
+        graph.for_each_edges_out(
+            graph.rank_to_id( i + 1 ),
+            [&graph, &unite, i]( id_type to, linktype_type ) {
+              unite( i, graph.id_to_rank( to ) - 1 );
+              return true;
+            } );
+      }
+
+      ConnectedComponents< rank_type, typename TGraph::offset_type > result;
+      result.labels.resize( n );
+      #pragma omp parallel for schedule( static )
+      for ( rank_type i = 0; i < n; ++i ) result.labels[ i ] = find( i );
+
+      // Roots are the lowest ranks of their components, so they precede the other members.
+      for ( rank_type i = 0; i < n; ++i ) {
+        if ( result.labels[ i ] == i ) {
+          result.labels[ i ] = result.first_ranks.size();
+          result.first_ranks.push_back( i + 1 );
+        }
+        else {
+          result.labels[ i ] = result.labels[ result.labels[ i ] ];
+        }
+      }
+
+      result.node_counts.resize( result.size(), 0 );
+      result.edge_counts.resize( result.size(), 0 );
+      result.sequence_lengths.resize( result.size(), 0 );
+      for ( rank_type i = 0; i < n; ++i ) {
+        id_type id = graph.rank_to_id( i + 1 );
+        auto label = result.labels[ i ];
+        ++result.node_counts[ label ];
+        result.edge_counts[ label ] += graph.outdegree( id );
+        result.sequence_lengths[ label ] += graph.node_length( id );
+      }
+      return result;
+    }
+
+    /**
+     *  @brief  Strongly connected components of a graph.
+     *
+     *  Components are numbered in a topological order of the condensed graph; i.e.
+     *  every edge between two components goes from the lower label to the higher one.
+     */
+    template< typename TRank >
+    struct StronglyConnectedComponents {
+      std::vector< TRank > labels;  /**< @brief Component of each vertex; see `strongly_connected_components` */
+      TRank count = 0;              /**< @brief Number of components */
+      bool sides = false;           /**< @brief Whether the vertices are oriented nodes rather than nodes */
+
+      inline std::size_t
+      size( ) const
+      {
+        return this->count;
+      }
+    };
+
+    /**
+     *  @brief  Get a function calling a callback on the successors of a vertex.
+     *
+     *  Vertices are zero-based. Node `rank` is vertex `rank - 1`. If `sides` is set,
+     *  vertices are oriented nodes indexed by `oriented_index` and their successors
+     *  are given by `for_each_oriented_successor`.
+     */
+    template< typename TGraph >
+    inline auto
+    _scc_successors( TGraph const& graph, bool sides )
+    {
+      using id_type = typename TGraph::id_type;
+      using rank_type = typename TGraph::rank_type;
+      using linktype_type = typename TGraph::linktype_type;
+      using side_type = typename TGraph::side_type;
+
+      return [&graph, sides]( rank_type vertex, auto callback ) {
+        if ( !sides ) {
+          graph.for_each_edges_out(
+              graph.rank_to_id( vertex + 1 ),
+              [&graph, &callback]( id_type to, linktype_type ) {
+                callback( graph.id_to_rank( to ) - 1 );
+                return true;
+              } );
+          return;
+        }
+        if constexpr ( std::is_same< typename TGraph::dir_type, Bidirected >::value ) {
+          for_each_oriented_successor(
+              graph, side_type( graph.rank_to_id( vertex / 2 + 1 ), vertex % 2 ),
+              [&graph, &callback]( side_type next ) {
+                callback( oriented_index( graph, next ) );
+                return true;
+              } );
+        }
+      };
+    }
+
+    /**
+     *  @brief  Find the strongly connected components of a graph.
+     *
+     *  Iterative Tarjan's algorithm. The DFS path is kept in an explicit stack, so its
+     *  depth is not bounded by the call stack. The successors of the nodes on the path
+     *  are buffered in one shared vector. Besides that, the memory used is two integers
+     *  and a bit per vertex.
+     *
+     *  By default, the vertices are the nodes and the edges are followed in their stored
+     *  direction, so the label of node `rank` is `labels[ rank - 1 ]`. If `sides` is set
+     *  on a bidirected graph, the vertices are the nodes in each orientation. Node
+     *  `rank` left from its side `s` is `labels[ 2 * ( rank - 1 ) + s ]`. Edges are then
+     *  traversable in both directions, entering a node through one side and leaving it
+     *  through the other. So a component and its reverse complement come in pairs.
+     *
+     *  The graph should be compact (see `DirectedGraph< Dynamic >::compact`);
+     *  otherwise, an exception is thrown.
+     *
+     *  @param  graph The graph.
+     *  @param  sides Whether to consider oriented nodes (sides) rather than nodes.
+     *  @return The component labels in topological order of the components.
+     */
+    template< typename TGraph >
+    inline StronglyConnectedComponents< typename TGraph::rank_type >
+    strongly_connected_components( TGraph const& graph, bool sides=false )
+    {
+      using rank_type = typename TGraph::rank_type;
+
+      struct Frame {
+        rank_type vertex;
+        std::size_t begin;  // successors of `vertex` are in [begin, end)
+        std::size_t next;
+        std::size_t end;
+      };
+
+      if ( sides && !std::is_same< typename TGraph::dir_type, Bidirected >::value ) {
+        throw std::runtime_error( "node sides are only defined for bidirected graphs" );
+      }
+      if ( graph.get_max_rank() != graph.get_node_count() ) {
+        throw std::runtime_error( "strongly connected components require a compact graph" );
+      }
+
+      auto for_each_successor = _scc_successors( graph, sides );
+      rank_type n = graph.get_node_count() * ( sides ? 2 : 1 );
+
+      std::vector< rank_type > index( n, 0 );  // zero for undiscovered vertices
+      std::vector< rank_type > lowlink( n, 0 );  // holds the component label once assigned
+      sdsl::bit_vector on_stack( n, 0 );
+      std::vector< rank_type > stack;
+      std::vector< rank_type > successors;
+      std::vector< Frame > path;
+      rank_type counter = 0;
+      rank_type count = 0;
+
+      auto discover =
+          [&]( rank_type vertex ) {
+            index[ vertex ] = lowlink[ vertex ] = ++counter;
+            stack.push_back( vertex );
+            on_stack[ vertex ] = 1;
+            std::size_t begin = successors.size();
+            for_each_successor( vertex, [&successors]( rank_type w ) { successors.push_back( w ); } );
+            path.push_back( { vertex, begin, begin, successors.size() } );
+          };
+
+      for ( rank_type root = 0; root < n; ++root ) {
+        if ( index[ root ] ) continue;
+        discover( root );
+        while ( !path.empty() ) {
+          Frame& frame = path.back();
+          if ( frame.next < frame.end ) {
+            rank_type w = successors[ frame.next++ ];
+            if ( !index[ w ] ) discover( w );  // invalidates `frame`
+            else if ( on_stack[ w ] ) {
+              lowlink[ frame.vertex ] = std::min( lowlink[ frame.vertex ], index[ w ] );
+            }
+            continue;
+          }
+
+          rank_type vertex = frame.vertex;
+          successors.resize( frame.begin );
+          path.pop_back();
+          if ( lowlink[ vertex ] == index[ vertex ] ) {
+            rank_type w;
+            do {
+              w = stack.back();
+              stack.pop_back();
+              on_stack[ w ] = 0;
+              lowlink[ w ] = count;
+            } while ( w != vertex );
+            ++count;
+          }
+          else {
+            rank_type& parent_lowlink = lowlink[ path.back().vertex ];
+            parent_lowlink = std::min( parent_lowlink, lowlink[ vertex ] );
+          }
+        }
+      }
+
+      // Tarjan's algorithm finds the components in reverse topological order.
+      #pragma omp parallel for schedule( static )
+      for ( rank_type i = 0; i < n; ++i ) lowlink[ i ] = count - 1 - lowlink[ i ];
+
+      StronglyConnectedComponents< rank_type > result;
+      result.labels = std::move( lowlink );
+      result.count = count;
+      result.sides = sides;
+      return result;
+    }
+
+    /**
+     *  @brief  Condense the strongly connected components of a graph.
+     *
+     *  Each component is contracted into a node whose ID is its label plus one. An
+     *  edge connects two components if an edge in the graph connects their vertices.
+     *  Since the labels are in topological order, the resulting graph is a DAG whose
+     *  node IDs are topologically sorted.
+     *
+     *  The graph should be compact as required by `strongly_connected_components`;
+     *  otherwise, an exception is thrown.
+     *
+     *  @param  graph The graph.
+     *  @param  components The components of the graph as given by `strongly_connected_components`.
+     *  @return The condensed graph.
+     */
+    template< typename TGraph >
+    inline DiSeqGraph< Dynamic >
+    condensation( TGraph const& graph,
+                  StronglyConnectedComponents< typename TGraph::rank_type > const& components )
+    {
+      using rank_type = typename TGraph::rank_type;
+      using condensed_type = DiSeqGraph< Dynamic >;
+      using cid_type = typename condensed_type::id_type;
+      using clink_type = typename condensed_type::link_type;
+
+      if ( graph.get_max_rank() != graph.get_node_count() ) {
+        throw std::runtime_error( "condensation requires a compact graph" );
+      }
+
+      auto for_each_successor = _scc_successors( graph, components.sides );
+      auto const& labels = components.labels;
+      rank_type n = labels.size();
+
+      std::vector< std::pair< cid_type, cid_type > > pairs;
+      #pragma omp parallel
+      {
+        std::vector< std::pair< cid_type, cid_type > > local;
+        #pragma omp for schedule( dynamic, 1024 ) nowait
+        for ( rank_type v = 0; v < n; ++v ) {
+          for_each_successor(
+              v,
+              [&labels, &local, v]( rank_type w ) {
+                if ( labels[ v ] != labels[ w ] ) local.push_back( { labels[ v ] + 1, labels[ w ] + 1 } );
+              } );
+        }
+        #pragma omp critical
+        pairs.insert( pairs.end(), local.begin(), local.end() );
+      }
+      std::sort( pairs.begin(), pairs.end() );
+      pairs.erase( std::unique( pairs.begin(), pairs.end() ), pairs.end() );
+
+      condensed_type condensed;
+      std::vector< cid_type > ids( components.count );
+      std::iota( ids.begin(), ids.end(), 1 );
+      condensed.add_nodes_bulk( ids.begin(), ids.end() );
+      std::vector< clink_type > links;
+      links.reserve( pairs.size() );
+      for ( auto const& p : pairs ) links.push_back( condensed.make_link( p.first, p.second ) );
+      condensed.add_edges_bulk( links.begin(), links.end() );
+      return condensed;
+    }
+
+    /**
+     *  @brief  Overlap of the edge between two consecutive steps of a path.
+     *
+     *  The edge can be stored in either direction. It is zero if there is no such
+     *  edge.
+     */
+    template< typename TGraph, typename TPath >
+    inline typename TGraph::offset_type
+    _path_step_overlap( TGraph const& graph, TPath const& path,
+                        typename TPath::value_type prev, typename TPath::value_type value )
+    {
+      using side_type = typename TGraph::side_type;
+
+      if ( !graph.has_edge_overlaps() ) return 0;
+      // A forward step is left from its end and entered from its start.
+      side_type from( path.id_of( prev ), !path.is_reverse( prev ) );
+      side_type to( path.id_of( value ), path.is_reverse( value ) );
+      if ( graph.has_edge( from, to ) ) return graph.edge_overlap( from, to );
+      if ( graph.has_edge( to, from ) ) return graph.edge_overlap( to, from );
+      return 0;
+    }
+
+    /**
+     *  @brief  Decode the sequence spelled by the steps [first, last) of a path.
+     *
+     *  Reverse steps are reverse complemented. The overlap of the edge entering
+     *  a step is skipped; including the one from the step preceding `first`.
+     *  Removed steps and steps on removed nodes are ignored.
+     *
+     *  @param  buffer A scratch string reused for decoding reverse steps.
+     */
+    template< typename TGraph, typename TPath, typename TOutputIt >
+    inline TOutputIt
+    _path_steps_sequence( TGraph const& graph, TPath const& path,
+                          std::size_t first, std::size_t last,
+                          TOutputIt d_first, std::string& buffer )
+    {
+      using graph_type = TGraph;
+      using id_type = typename graph_type::id_type;
+      using offset_type = typename graph_type::offset_type;
+      using value_type = typename TPath::value_type;
+
+      auto begin = path.begin();
+      bool overlaps = graph.has_edge_overlaps();
+      bool has_prev = false;
+      value_type prev = 0;
+      for ( std::size_t i = first; overlaps && !has_prev && i > 0; ) {
+        prev = *( begin + --i );
+        has_prev = graph.has_node( path.id_of( prev ) );
+      }
+
+      for ( std::size_t i = first; i < last; ++i ) {
+        value_type value = *( begin + i );
+        id_type id = path.id_of( value );
+        if ( !graph.has_node( id ) ) continue;
+        bool reverse = path.is_reverse( value );
+        offset_type len = graph.node_length( id );
+        offset_type skip = 0;
+        if ( overlaps && has_prev ) {
+          skip = std::min( _path_step_overlap( graph, path, prev, value ), len );
+        }
+        if ( !reverse ) {
+          d_first = graph.extract_node_sequence( id, skip, len, d_first );
+        }
+        else {
+          buffer.resize( len - skip );
+          graph.extract_node_sequence( id, 0, len - skip, buffer.begin() );
+          util::reverse_complement( buffer.begin(), buffer.end() );
+          d_first = std::copy( buffer.begin(), buffer.end(), d_first );
+        }
+        prev = value;
+        has_prev = true;
+      }
+      return d_first;
+    }
+
+    /**
+     *  @brief  Write the sequence spelled by a path to an output iterator.
+     *
+     *  The node sequences are decoded directly into `d_first` without building
+     *  the whole path sequence; see `_path_steps_sequence` for the handling of
+     *  reverse steps and edge overlaps.
+     *
+     *  @param  graph A sequence graph.
+     *  @param  path_id A path ID in the graph.
+     *  @param  d_first The output iterator.
+     *  @return Output iterator to the element past the last one written.
+     */
+    template< typename TGraph, typename TOutputIt >
+    inline TOutputIt
+    path_sequence( TGraph const& graph, typename TGraph::id_type path_id, TOutputIt d_first )
+    {
+      auto const& path = graph.path( path_id );
+      std::string buffer;
+      return _path_steps_sequence( graph, path, 0, path.end() - path.begin(), d_first, buffer );
+    }
+
+    /**
+     *  @brief  Write the sequences of all paths in FASTA format.
+     *
+     *  Paths are written in rank order named by their path names. Each path is
+     *  processed in rounds of `threads` consecutive blocks of steps which are
+     *  decoded in parallel into separate buffers and then written in order. So,
+     *  the memory usage is bounded by the size of a round rather than the length
+     *  of the longest path.
+     *
+     *  @param  graph A sequence graph.
+     *  @param  os The output stream.
+     *  @param  threads Number of threads decoding the blocks of a round.
+     *  @param  line_width Maximum length of sequence lines; zero for no wrapping.
+     */
+    template< typename TGraph >
+    inline void
+    write_paths_fasta( TGraph const& graph, std::ostream& os, unsigned int threads=1,
+                       std::size_t line_width=0 )
+    {
+      using graph_type = TGraph;
+      using id_type = typename graph_type::id_type;
+      using rank_type = typename graph_type::rank_type;
+
+      constexpr std::size_t BLOCK_STEPS = 4096;
+
+      threads = std::max( threads, 1u );
+      std::vector< std::string > blocks( threads );
+      std::vector< std::string > buffers( threads );
+      graph.for_each_path(
+          [&]( rank_type, id_type pid ) {
+            auto const& path = graph.path( pid );
+            std::size_t nsteps = path.end() - path.begin();
+            std::size_t column = 0;
+            std::size_t written = 0;
+            os << '>' << graph.path_name( pid ) << '\n';
+            for ( std::size_t first = 0; first < nsteps; first += threads * BLOCK_STEPS ) {
+              #pragma omp parallel for num_threads( threads ) schedule( static, 1 )
+              for ( unsigned int t = 0; t < threads; ++t ) {
+                std::size_t bfirst = std::min( first + t * BLOCK_STEPS, nsteps );
+                std::size_t blast = std::min( bfirst + BLOCK_STEPS, nsteps );
+                blocks[ t ].clear();
+                _path_steps_sequence( graph, path, bfirst, blast,
+                                      std::back_inserter( blocks[ t ] ), buffers[ t ] );
+              }
+              for ( auto const& block : blocks ) {
+                written += block.size();
+                if ( line_width == 0 ) {
+                  os.write( block.data(), block.size() );
+                  continue;
+                }
+                for ( std::size_t pos = 0; pos < block.size(); ) {
+                  std::size_t len = std::min( line_width - column, block.size() - pos );
+                  os.write( block.data() + pos, len );
+                  pos += len;
+                  column += len;
+                  if ( column == line_width ) {
+                    os << '\n';
+                    column = 0;
+                  }
+                }
+              }
+            }
+            if ( line_width == 0 || column != 0 || written == 0 ) os << '\n';
+            return true;
+          } );
+    }
+
+    /**
+     *  @brief  Extract the subgraph within a context distance of a set of seeds.
+     *
+     *  A seed is either a node ID or a position given as a pair of a node ID and
+     *  an offset in its sequence. All seeds are processed together by a single
+     *  multi-source Dijkstra search over both sides of the nodes. In `BasePairs`,
+     *  the distance of a node is the one of its nearest base to the nearest seed;
+     *  i.e. the adjacent nodes of a seed node are at distance one. In `Steps`, it
+     *  is the number of edges from the nearest seed node. The nodes at distance
+     *  at most `context` are kept.
+     *
+     *  The subgraph is induced by the kept nodes in their rank order. The nodes
+     *  keep their original IDs (the coordinate IDs for a `Succinct` graph); so the
+     *  subgraph can be mapped back to the graph. Each maximal run of path steps on
+     *  the kept nodes becomes a path named `<name>:<start>-<end>`, where [start,
+     *  end) is the range of the run in the spelled sequence of the path (see
+     *  `path_sequence`). The result can be converted to a compact `Succinct` graph
+     *  by its `succinct_type` constructor. A seed whose ID does not exist in the
+     *  graph, or whose offset is out of its node sequence, raises an exception.
+     *
+     *  NOTE: The search walks the oriented nodes; so only bidirected graphs are
+     *  supported.
+     *
+     *  @param  graph A bidirected sequence graph.
+     *  @param  seeds A container of node IDs or positions.
+     *  @param  context The maximum distance of the kept nodes.
+     *  @return A `Dynamic` graph of the extracted subgraph.
+     */
+    template< typename TGraph, typename TContainer, typename TUnit=BasePairs,
+              typename=std::enable_if_t< std::is_same< TUnit, BasePairs >::value ||
+                                         std::is_same< TUnit, Steps >::value > >
+    inline typename TGraph::dynamic_type
+    extract_subgraph( TGraph const& graph, TContainer const& seeds, std::size_t context,
+                      TUnit={} )
+    {
+      using graph_type = TGraph;
+      using id_type = typename graph_type::id_type;
+      using rank_type = typename graph_type::rank_type;
+      using offset_type = typename graph_type::offset_type;
+      using side_type = typename graph_type::side_type;
+      using linktype_type = typename graph_type::linktype_type;
+      using seed_type = typename TContainer::value_type;
+      using target_type = typename graph_type::dynamic_type;
+      using target_node_type = typename target_type::node_type;
+      using target_edge_type = typename target_type::edge_type;
+      using distance_type = std::size_t;
+      using entry_type = std::pair< distance_type, rank_type >;
+
+      static_assert( std::is_same< typename graph_type::dir_type, Bidirected >::value,
+                     "subgraph extraction is only defined for bidirected graphs" );
+
+      constexpr const bool bp = std::is_same< TUnit, BasePairs >::value;
+      constexpr const distance_type UNREACHED = std::numeric_limits< distance_type >::max();
+
+      std::vector< distance_type > dist( graph.get_max_rank(), UNREACHED );
+      std::priority_queue< entry_type, std::vector< entry_type >, std::greater< entry_type > > queue;
+
+      // Reach the nodes adjacent to a side of a node at distance `d`.
+      auto reach =
+          [&graph, &dist, &queue, context]( id_type id, bool end, distance_type d ) {
+            if ( d > context ) return;
+            for_each_oriented_successor(
+                graph, side_type( id, end ),
+                [&graph, &dist, &queue, d]( side_type next ) {
+                  rank_type rank = graph.id_to_rank( graph.id_of( next ) );
+                  if ( d < dist[ rank - 1 ] ) {
+                    dist[ rank - 1 ] = d;
+                    queue.push( { d, rank } );
+                  }
+                  return true;
+                } );
+          };
+
+      // Seeds are at distance zero and never expanded from the queue; their queued
+      // entries, if any, are stale.
+      for ( auto const& seed : seeds ) {
+        if constexpr ( std::is_convertible< seed_type, id_type >::value ) {
+          if ( !graph.has_node( seed ) ) {
+            throw std::runtime_error( "extracting a subgraph with non-existent seed ID" );
+          }
+          dist[ graph.id_to_rank( seed ) - 1 ] = 0;
+        }
+        else {
+          if ( !graph.has_node( seed.first ) ) {
+            throw std::runtime_error( "extracting a subgraph with non-existent seed ID" );
+          }
+          if ( seed.second >= graph.node_length( seed.first ) ) {
+            throw std::runtime_error( "extracting a subgraph with out-of-range seed offset" );
+          }
+          dist[ graph.id_to_rank( seed.first ) - 1 ] = 0;
+        }
+      }
+      for ( auto const& seed : seeds ) {
+        if constexpr ( std::is_convertible< seed_type, id_type >::value ) {
+          reach( seed, false, 1 );
+          reach( seed, true, 1 );
+        }
+        else {
+          id_type id = seed.first;
+          offset_type offset = seed.second;
+          reach( id, false, bp ? offset + 1 : 1 );
+          reach( id, true, bp ? graph.node_length( id ) - offset : 1 );
+        }
+      }
+      while ( !queue.empty() ) {
+        auto [ d, rank ] = queue.top();
+        queue.pop();
+        if ( d != dist[ rank - 1 ] ) continue;  // stale entry
+        id_type id = graph.rank_to_id( rank );
+        distance_type next = d + ( bp ? graph.node_length( id ) : 1 );
+        reach( id, false, next );
+        reach( id, true, next );
+      }
+
+      auto kept =
+          [&graph, &dist]( id_type id ) {
+            return dist[ graph.id_to_rank( id ) - 1 ] != UNREACHED;
+          };
+
+      target_type subgraph;
+      graph.for_each_node(
+          [&graph, &dist, &subgraph]( rank_type rank, id_type id ) {
+            if ( dist[ rank - 1 ] == UNREACHED ) return true;
+            std::string seq;
+            seq.reserve( graph.node_length( id ) );
+            graph.extract_node_sequence( id, 0, graph.node_length( id ), std::back_inserter( seq ) );
+            auto node = graph.get_node_prop( rank );
+            std::string name( node.name.begin(), node.name.end() );
+            subgraph.add_node( target_node_type( std::move( seq ), std::move( name ) ),
+                               graph.coordinate_id( id ) );
+            return true;
+          } );
+      graph.for_each_node(
+          [&graph, &dist, &subgraph, &kept]( rank_type rank, id_type id ) {
+            if ( dist[ rank - 1 ] == UNREACHED ) return true;
+            graph.for_each_edges_out(
+                id,
+                [&graph, &subgraph, &kept, id]( id_type to, linktype_type type ) {
+                  if ( !kept( to ) ) return true;
+                  subgraph.add_edge(
+                      subgraph.make_link( graph.coordinate_id( id ), graph.coordinate_id( to ), type ),
+                      target_edge_type( graph.edge_overlap( id, to, type ) ) );
+                  return true;
+                } );
+            return true;
+          } );
+      graph.for_each_path(
+          [&graph, &subgraph, &kept]( rank_type, id_type pid ) {
+            auto const& path = graph.path( pid );
+            using value_type = typename std::decay_t< decltype( path ) >::value_type;
+            std::string name( graph.path_name( pid ) );
+            std::vector< std::pair< id_type, bool > > run;
+            std::size_t pos = 0;
+            std::size_t start = 0;
+            std::size_t end = 0;
+            auto flush =
+                [&graph, &subgraph, &name, &run, &start, &end]() {
+                  if ( run.empty() ) return;
+                  auto fid = subgraph.add_path( name + ":" + std::to_string( start ) + "-" +
+                                                std::to_string( end ) );
+                  for ( auto const& [ id, reverse ] : run ) {
+                    subgraph.extend_path( fid, graph.coordinate_id( id ), reverse );
+                  }
+                  run.clear();
+                };
+
+            bool has_prev = false;
+            value_type prev = 0;
+            for ( auto it = path.begin(); it != path.end(); ++it ) {
+              value_type value = *it;
+              id_type id = path.id_of( value );
+              if ( !graph.has_node( id ) ) continue;  // removed step
+              std::size_t skip = has_prev ? _path_step_overlap( graph, path, prev, value ) : 0;
+              std::size_t step_start = pos - std::min< std::size_t >( skip, graph.node_length( id ) );
+              pos = step_start + graph.node_length( id );
+              if ( kept( id ) ) {
+                if ( run.empty() ) start = step_start;
+                run.push_back( { id, path.is_reverse( value ) } );
+                end = pos;
+              }
+              else {
+                flush();
+              }
+              prev = value;
+              has_prev = true;
+            }
+            flush();
+            return true;
+          } );
+      return subgraph;
+    }
+
+    /**
+     *  @brief  Get the narrowest integer width required by the Succinct form of a graph.
+     *
+     *  Node IDs of a `Succinct` graph are positions in its underlying integer
+     *  vector which also embeds node coordinate IDs, sequence offsets and
+     *  degrees. So, the width is determined by the length of that vector, the
+     *  maximum node ID, the total sequence length, and the maximum degree.
+     *
+     *  @param  graph A `Dynamic` sequence graph.
+     *  @return 32 if all these values fit in 32-bit integers; otherwise 64.
+     */
+    template< typename TGraph,
+              typename=std::enable_if_t< std::is_same< typename TGraph::spec_type, Dynamic >::value > >
+    inline uint8_t
+    succinct_width( TGraph const& graph )
+    {
+      using graph_type = TGraph;
+      using id_type = typename graph_type::id_type;
+      using rank_type = typename graph_type::rank_type;
+      using succinct_type = typename graph_type::succinct_type;
+      using succinct_trait_type = typename succinct_type::trait_type;
+
+      constexpr uint64_t max32 = std::numeric_limits< integer_t< 32 > >::max();
+
+      id_type max_id = 0;
+      rank_type max_degree = 0;
+      graph.for_each_node(
+          [&graph, &max_id, &max_degree]( rank_type, id_type id ) {
+            max_id = std::max( max_id, id );
+            max_degree = std::max( { max_degree, graph.outdegree( id ), graph.indegree( id ) } );
+            return true;
+          } );
+      uint64_t nodes_len =
+          graph.get_node_count() * ( succinct_trait_type::HEADER_CORE_LEN + succinct_type::NODE_PADDING ) +
+          2 * graph.get_edge_count() *
+              ( succinct_trait_type::EDGE_CORE_LEN + ( graph.has_edge_overlaps() ? succinct_type::EDGE_PADDING : 0 ) ) +
+          1;
+      uint64_t seqs_len = graph.get_node_prop().get_sequences_len_sum();
+
+      if ( nodes_len <= max32 && static_cast< uint64_t >( max_id ) <= max32 &&
+           seqs_len <= max32 && max_degree <= max32 ) {
+        return 32;
+      }
+      return 64;
+    }
+
+    /**
+     *  @brief  Copy a `Dynamic` sequence graph into another one with possibly
+     *          different integer widths.
+     *
+     *  Node IDs, node ranks, edges and paths are preserved.
+     *
+     *  NOTE: This function assumes that the values of the source graph fit in
+     *  the integer types of the target graph (see `succinct_width`).
+     *
+     *  @param  graph The source `Dynamic` graph.
+     *  @param  target The target `Dynamic` graph.
+     */
+    template< typename TGraph1, typename TGraph2,
+              typename=std::enable_if_t< std::is_same< typename TGraph1::spec_type, Dynamic >::value &&
+                                         std::is_same< typename TGraph2::spec_type, Dynamic >::value > >
+    inline void
+    copy_graph( TGraph1 const& graph, TGraph2& target )
+    {
+      using graph_type = TGraph1;
+      using id_type = typename graph_type::id_type;
+      using rank_type = typename graph_type::rank_type;
+      using linktype_type = typename graph_type::linktype_type;
+      using target_type = TGraph2;
+      using target_id_type = typename target_type::id_type;
+      using target_node_type = typename target_type::node_type;
+      using target_edge_type = typename target_type::edge_type;
+
+      target.clear();
+      graph.for_each_node(
+          [&graph, &target]( rank_type rank, id_type id ) {
+            auto const& node = graph.get_node_prop()( rank );
+            target.add_node( target_node_type( node ),
+                             static_cast< target_id_type >( id ) );
+            return true;
+          } );
+      graph.for_each_node(
+          [&graph, &target]( rank_type, id_type id ) {
+            graph.for_each_edges_out(
+                id,
+                [&graph, &target, id]( id_type to, linktype_type type ) {
+                  target.add_edge(
+                      target.make_link( static_cast< target_id_type >( id ),
+                                        static_cast< target_id_type >( to ), type ),
+                      target_edge_type( graph.edge_overlap( id, to, type ) ) );
+                  return true;
+                } );
+            return true;
+          } );
+      graph.for_each_path(
+          [&graph, &target]( rank_type, id_type pid ) {
+            auto const& path = graph.path( pid );
+            auto tpid = target.add_path( path.get_name() );
+            for ( auto const& value : path ) {
+              // Skip steps on removed nodes.
+              if ( !graph.has_node( path.id_of( value ) ) ) continue;
+              target.extend_path( tpid, static_cast< target_id_type >( path.id_of( value ) ),
+                                  path.is_reverse( value ) );
+            }
+            return true;
+          } );
+    }
+
+    /**
+     *  @brief  Build a Succinct graph with the narrowest sufficient integer widths.
+     *
+     *  The alternatives of `TVariant` are tried in order and the first one
+     *  whose integer width is sufficient to represent the graph is constructed
+     *  (see `SeqGraphVariant`). The hot algorithms can then be dispatched by
+     *  `std::visit` on the returned variant.
+     *
+     *  NOTE: A `Succinct` graph can only be constructed from a `Dynamic` graph of
+     *  the same integer widths. If the chosen alternative differs from `graph` in
+     *  widths, `graph` is first copied into a temporary `Dynamic` graph of those
+     *  widths (see `copy_graph`). Its peak memory is then roughly twice the size
+     *  of `graph`, plus the resulting `Succinct` graph. Use a `Dynamic` graph of the
+     *  narrow widths in the first place to avoid the copy when memory is tight.
+     *
+     *  @param  graph A `Dynamic` sequence graph.
+     *  @param  out_only Store only outgoing edges (see `DirectedGraph< Succinct >`).
+     *  @return A variant holding the constructed `Succinct` graph.
+     */
+    template< typename TVariant = SeqGraphVariant<>, typename TGraph,
+              typename=std::enable_if_t< std::is_same< typename TGraph::spec_type, Dynamic >::value > >
+    inline TVariant
+    make_succinct_variant( TGraph const& graph, bool out_only = false )
+    {
+      using narrow_type = std::variant_alternative_t< 0, TVariant >;
+      using wide_type = std::variant_alternative_t< 1, TVariant >;
+
+      auto make =
+          [&graph, out_only]( auto index ) -> TVariant {
+            using succinct_type = std::variant_alternative_t< decltype( index )::value, TVariant >;
+            using dynamic_type = typename succinct_type::dynamic_type;
+            if constexpr ( std::is_constructible_v< succinct_type, TGraph const& > ) {
+              return TVariant( std::in_place_index< decltype( index )::value >, graph, out_only );
+            }
+            else {
+              dynamic_type d_graph;
+              copy_graph( graph, d_graph );
+              return TVariant( std::in_place_index< decltype( index )::value >, d_graph, out_only );
+            }
+          };
+
+      if ( util::succinct_width( graph ) <= widthof< typename narrow_type::value_type >::value ) {
+        return make( std::integral_constant< std::size_t, 0 >{} );
+      }
+      static_assert( widthof< typename wide_type::value_type >::value == 64, "the widest alternative should be 64-bit" );
+      return make( std::integral_constant< std::size_t, 1 >{} );
+    }
   }  /* --- end of namespace util --- */
 }  /* --- end of namespace gum --- */
 
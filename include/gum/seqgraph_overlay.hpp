@@ -0,0 +1,791 @@
+/**
+ *    @file  seqgraph_overlay.hpp
+ *   @brief  Mutable overlay on top of an immutable Succinct sequence graph
+ *
+ *  This header file defines `SeqGraphOverlay` class which records modifications
+ *  to a `Succinct` sequence graph in small dynamic structures without touching
+ *  the underlying graph.
+ *
+ *  @author  Ali Ghaffaari (\@cartoonist), <ali.ghaffaari@mpi-inf.mpg.de>
+ *
+ *  @internal
+ *       Created:  Sat Oct 17, 2026  11:02
+ *  Organization:  Max-Planck-Institut fuer Informatik
+ *     Copyright:  Copyright (c) 2026, Ali Ghaffaari
+ *
+ *  This source code is released under the terms of the MIT License.
+ *  See LICENSE file for more information.
+ */
+
+#ifndef  GUM_SEQGRAPH_OVERLAY_HPP__
+#define  GUM_SEQGRAPH_OVERLAY_HPP__
+
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+#include <parallel_hashmap/phmap.h>
+
+#include "seqgraph.hpp"
+
+
+namespace gum {
+  /**
+   *  @brief  Mutable overlay on top of a Succinct sequence graph.
+   *
+   *  The overlay refers to an immutable `SeqGraph< Succinct >` (the base graph)
+   *  and records added nodes, edges and paths as well as removed nodes and
+   *  edges (tombstones) in small dynamic structures. Queries are answered by
+   *  merging the base graph and the delta. The delta can be folded into a new
+   *  Succinct graph by `compact`.
+   *
+   *  Node IDs of the base graph are kept in the overlay. Added nodes get IDs
+   *  beyond the last valid ID of the base graph. Similarly, added paths get IDs
+   *  larger than the IDs of the paths in the base graph.
+   *
+   *  NOTE: The base graph should outlive the overlay.
+   *
+   *  NOTE: Removing a node removes all edges incident to it. The node is also
+   *  skipped when iterating over path nodes.
+   */
+  template< typename TGraph >
+  class SeqGraphOverlay {
+  public:
+    /* === TYPEDEFS === */
+    using graph_type = TGraph;
+    using spec_type = typename graph_type::spec_type;
+    using dir_type = typename graph_type::dir_type;
+    using id_type = typename graph_type::id_type;
+    using offset_type = typename graph_type::offset_type;
+    using rank_type = typename graph_type::rank_type;
+    using size_type = typename graph_type::size_type;
+    using string_type = typename graph_type::string_type;
+    using side_type = typename graph_type::side_type;
+    using link_type = typename graph_type::link_type;
+    using linktype_type = typename graph_type::linktype_type;
+    using dynamic_type = typename graph_type::dynamic_type;
+    using sequence_type = typename dynamic_type::sequence_type;
+    using node_type = typename dynamic_type::node_type;
+    using edge_type = typename dynamic_type::edge_type;
+    using adjs_type = std::vector< side_type >;
+    using step_type = std::pair< id_type, bool >;
+
+    static_assert( std::is_same< spec_type, Succinct >::value, "overlay requires a Succinct base graph" );
+
+  private:
+    using dynamic_trait_type = typename dynamic_type::trait_type;
+    using hash_side = typename dynamic_trait_type::hash_side;
+    using hash_link = typename dynamic_trait_type::hash_link;
+    using adj_map_type = phmap::flat_hash_map< side_type, adjs_type, hash_side >;
+    using overlap_map_type = phmap::flat_hash_map< link_type, offset_type, hash_link >;
+    using link_set_type = phmap::flat_hash_set< link_type, hash_link >;
+    using id_set_type = phmap::flat_hash_set< id_type >;
+
+    struct AddedNode {
+      node_type node;
+      id_type ext_id;
+    };
+
+    struct AddedPath {
+      id_type id;
+      string_type name;
+      std::vector< step_type > steps;
+    };
+
+  public:
+    /* === LIFECYCLE === */
+    SeqGraphOverlay( graph_type const& base )
+      : base( &base ), removed_base_nodes( 0 ), added_edge_count( 0 )
+    {
+      this->first_new_id = this->base->get_nodes().size();
+      this->first_new_pid = 1;
+      this->base->for_each_path(
+          [this]( rank_type, id_type pid ) {
+            this->first_new_pid = std::max( this->first_new_pid, pid + 1 );
+            return true;
+          } );
+    }
+
+    /* === ACCESSORS === */
+    inline graph_type const&
+    get_base( ) const
+    {
+      return *this->base;
+    }
+
+    inline rank_type
+    get_node_count( ) const
+    {
+      return this->base->get_node_count() - this->removed_base_nodes +
+          this->added_nodes.size() - ( this->removed_nodes.size() - this->removed_base_nodes );
+    }
+
+    inline rank_type
+    get_edge_count( ) const
+    {
+      return this->base->get_edge_count() - this->removed_edges.size() + this->added_edge_count;
+    }
+
+    inline rank_type
+    get_path_count( ) const
+    {
+      return this->base->get_path_count() + this->added_paths.size();
+    }
+
+    /**
+     *  @brief  Whether the overlay has any modification over the base graph.
+     */
+    inline bool
+    empty( ) const
+    {
+      return this->added_nodes.empty() && this->removed_nodes.empty() &&
+          this->added_edge_count == 0 && this->removed_edges.empty() &&
+          this->added_paths.empty();
+    }
+
+    /* === METHODS === */
+    inline id_type
+    id_of( side_type side ) const
+    {
+      return this->base->id_of( side );
+    }
+
+    inline side_type
+    from_side( id_type id, linktype_type type=graph_type::trait_type::get_default_linktype() ) const
+    {
+      return this->base->from_side( id, type );
+    }
+
+    inline side_type
+    to_side( id_type id, linktype_type type=graph_type::trait_type::get_default_linktype() ) const
+    {
+      return this->base->to_side( id, type );
+    }
+
+    inline side_type
+    start_side( id_type id ) const
+    {
+      return this->base->start_side( id );
+    }
+
+    inline side_type
+    end_side( id_type id ) const
+    {
+      return this->base->end_side( id );
+    }
+
+    inline link_type
+    make_link( side_type from, side_type to ) const
+    {
+      return this->base->make_link( from, to );
+    }
+
+    inline link_type
+    make_link( id_type from, id_type to,
+               linktype_type type=graph_type::trait_type::get_default_linktype() ) const
+    {
+      return this->base->make_link( from, to, type );
+    }
+
+    inline linktype_type
+    linktype( side_type from, side_type to ) const
+    {
+      return this->base->linktype( from, to );
+    }
+
+    inline bool
+    has_node( id_type id ) const
+    {
+      if ( this->is_removed( id ) ) return false;
+      return this->base->has_node( id ) || this->is_added( id );
+    }
+
+    inline bool
+    has_node( side_type side ) const
+    {
+      return this->has_node( this->id_of( side ) );
+    }
+
+    /**
+     *  @brief  Add a node to the overlay.
+     *
+     *  @param  node The node sequence and name.
+     *  @param  ext_id The coordinate ID of the node in the compacted graph;
+     *                 chosen automatically by `compact` if it is zero.
+     *  @return The ID of the added node in the overlay.
+     */
+    inline id_type
+    add_node( node_type node=node_type(), id_type ext_id=0 )
+    {
+      this->added_nodes.push_back( { std::move( node ), ext_id } );
+      return this->first_new_id + this->added_nodes.size() - 1;
+    }
+
+    /**
+     *  @brief  Remove a node and all its incident edges.
+     */
+    inline void
+    remove_node( id_type id )
+    {
+      if ( !this->has_node( id ) ) throw std::runtime_error( "removing a non-existent node" );
+      std::vector< link_type > links;
+      this->for_each_edges_out(
+          id,
+          [this, &links, id]( id_type to, linktype_type type ) {
+            links.push_back( this->make_link( id, to, type ) );
+            return true;
+          } );
+      this->for_each_edges_in(
+          id,
+          [this, &links, id]( id_type from, linktype_type type ) {
+            links.push_back( this->make_link( from, id, type ) );
+            return true;
+          } );
+      for ( auto const& sides : links ) {
+        // Self-loops are visited twice.
+        if ( this->has_edge( sides ) ) this->remove_edge( sides );
+      }
+      this->removed_nodes.insert( id );
+      if ( this->base->has_node( id ) ) ++this->removed_base_nodes;
+    }
+
+    /**
+     *  @brief  Call a callback on each nodes; base nodes first in their rank order.
+     *
+     *  The rank passed to the `callback` is the rank of the node among the
+     *  existing nodes of the overlay.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_node( TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, rank_type, id_type >, "received a non-invocable as callback" );
+
+      rank_type rank = 0;
+      bool completed = this->base->for_each_node(
+          [this, &rank, &callback]( rank_type, id_type id ) {
+            if ( this->is_removed( id ) ) return true;
+            return callback( ++rank, id );
+          } );
+      if ( !completed ) return false;
+      for ( size_type i = 0; i < this->added_nodes.size(); ++i ) {
+        id_type id = this->first_new_id + i;
+        if ( this->is_removed( id ) ) continue;
+        if ( !callback( ++rank, id ) ) return false;
+      }
+      return true;
+    }
+
+    inline sequence_type
+    node_sequence( id_type id ) const
+    {
+      assert( this->has_node( id ) );
+      if ( this->is_added( id ) ) return this->added_node( id ).node.sequence;
+      auto seq = this->base->node_sequence( id );
+      return sequence_type( seq.begin(), seq.end() );
+    }
+
+    inline offset_type
+    node_length( id_type id ) const
+    {
+      assert( this->has_node( id ) );
+      if ( this->is_added( id ) ) return this->added_node( id ).node.sequence.size();
+      return this->base->node_length( id );
+    }
+
+    inline void
+    add_edge( link_type sides, edge_type edge=edge_type() )
+    {
+      assert( this->has_node( this->base->from_id( sides ) ) &&
+              this->has_node( this->base->to_id( sides ) ) );
+      assert( !this->has_edge( sides ) );
+      side_type from = this->base->from_side( sides );
+      side_type to = this->base->to_side( sides );
+      this->adj_out[ from ].push_back( to );
+      this->adj_in[ to ].push_back( from );
+      this->added_overlaps[ sides ] = edge.overlap;
+      ++this->added_edge_count;
+    }
+
+    inline void
+    add_edge( side_type from, side_type to, edge_type edge=edge_type() )
+    {
+      this->add_edge( this->make_link( from, to ), edge );
+    }
+
+    inline void
+    remove_edge( link_type sides )
+    {
+      auto found = this->added_overlaps.find( sides );
+      if ( found != this->added_overlaps.end() ) {
+        side_type from = this->base->from_side( sides );
+        side_type to = this->base->to_side( sides );
+        auto& outs = this->adj_out[ from ];
+        outs.erase( std::find( outs.begin(), outs.end(), to ) );
+        auto& ins = this->adj_in[ to ];
+        ins.erase( std::find( ins.begin(), ins.end(), from ) );
+        this->added_overlaps.erase( found );
+        --this->added_edge_count;
+      }
+      else if ( this->has_base_edge( sides ) ) {
+        this->removed_edges.insert( sides );
+      }
+      else throw std::runtime_error( "removing a non-existent edge" );
+    }
+
+    inline void
+    remove_edge( side_type from, side_type to )
+    {
+      this->remove_edge( this->make_link( from, to ) );
+    }
+
+    inline bool
+    has_edge( link_type sides ) const
+    {
+      if ( this->added_overlaps.find( sides ) != this->added_overlaps.end() ) return true;
+      return this->has_base_edge( sides );
+    }
+
+    inline bool
+    has_edge( side_type from, side_type to ) const
+    {
+      return this->has_edge( this->make_link( from, to ) );
+    }
+
+    inline bool
+    has_edge( id_type from, id_type to,
+              linktype_type type=graph_type::trait_type::get_default_linktype() ) const
+    {
+      return this->has_edge( this->make_link( from, to, type ) );
+    }
+
+    inline offset_type
+    edge_overlap( link_type sides ) const
+    {
+      assert( this->has_edge( sides ) );
+      auto found = this->added_overlaps.find( sides );
+      if ( found != this->added_overlaps.end() ) return found->second;
+      return this->base->edge_overlap( sides );
+    }
+
+    inline offset_type
+    edge_overlap( side_type from, side_type to ) const
+    {
+      return this->edge_overlap( this->make_link( from, to ) );
+    }
+
+    inline offset_type
+    edge_overlap( id_type from, id_type to,
+                  linktype_type type=graph_type::trait_type::get_default_linktype() ) const
+    {
+      return this->edge_overlap( this->make_link( from, to, type ) );
+    }
+
+    /**
+     *  @brief  Call a `callback` on each outgoing edges from `from` side.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_edges_out( side_type from, TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, side_type >, "received a non-invocable as callback" );
+
+      return this->for_each_edges_out(
+          this->id_of( from ),
+          [this, from, &callback]( id_type id, linktype_type type ) {
+            if ( !this->base->is_valid_from( from, type ) ) return true;
+            return callback( this->to_side( id, type ) );
+          } );
+    }
+
+    /**
+     *  @brief  Call a `callback` on each outgoing edges from each side of a node.
+     *
+     *  The `callback` function should get the outgoing node ID and the edge
+     *  type; and return `true` to continue the iteration, and `false` to stop
+     *  it. Edges of the base graph are visited first.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_edges_out( id_type id, TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type >, "received a non-invocable as callback" );
+
+      if ( this->is_removed( id ) ) return true;
+      if ( this->base->has_node( id ) ) {
+        bool completed = this->base->for_each_edges_out(
+            id,
+            [this, id, &callback]( id_type to, linktype_type type ) {
+              if ( this->is_removed_edge( this->make_link( id, to, type ) ) ) return true;
+              return callback( to, type );
+            } );
+        if ( !completed ) return false;
+      }
+      return this->base->for_each_side(
+          id,
+          [this, &callback]( side_type from ) {
+            auto found = this->adj_out.find( from );
+            if ( found == this->adj_out.end() ) return true;
+            for ( side_type to : found->second ) {
+              if ( !callback( this->id_of( to ), this->linktype( from, to ) ) ) return false;
+            }
+            return true;
+          } );
+    }
+
+    /**
+     *  @brief  Call a `callback` on each incoming edges to `to` side.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_edges_in( side_type to, TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, side_type >, "received a non-invocable as callback" );
+
+      return this->for_each_edges_in(
+          this->id_of( to ),
+          [this, to, &callback]( id_type id, linktype_type type ) {
+            if ( !this->base->is_valid_to( to, type ) ) return true;
+            return callback( this->from_side( id, type ) );
+          } );
+    }
+
+    /**
+     *  @brief  Call a `callback` on each incoming edges to each side of a node.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_edges_in( id_type id, TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type >, "received a non-invocable as callback" );
+
+      if ( this->is_removed( id ) ) return true;
+      if ( this->base->has_node( id ) ) {
+        bool completed = this->base->for_each_edges_in(
+            id,
+            [this, id, &callback]( id_type from, linktype_type type ) {
+              if ( this->is_removed_edge( this->make_link( from, id, type ) ) ) return true;
+              return callback( from, type );
+            } );
+        if ( !completed ) return false;
+      }
+      return this->base->for_each_side(
+          id,
+          [this, &callback]( side_type to ) {
+            auto found = this->adj_in.find( to );
+            if ( found == this->adj_in.end() ) return true;
+            for ( side_type from : found->second ) {
+              if ( !callback( this->id_of( from ), this->linktype( from, to ) ) ) return false;
+            }
+            return true;
+          } );
+    }
+
+    inline adjs_type
+    adjacents_out( side_type from ) const
+    {
+      adjs_type adjs;
+      this->for_each_edges_out(
+          from,
+          [&adjs]( side_type to ) {
+            adjs.push_back( to );
+            return true;
+          } );
+      return adjs;
+    }
+
+    inline adjs_type
+    adjacents_in( side_type to ) const
+    {
+      adjs_type adjs;
+      this->for_each_edges_in(
+          to,
+          [&adjs]( side_type from ) {
+            adjs.push_back( from );
+            return true;
+          } );
+      return adjs;
+    }
+
+    inline rank_type
+    outdegree( id_type id ) const
+    {
+      rank_type retval = 0;
+      this->for_each_edges_out(
+          id,
+          [&retval]( id_type, linktype_type ) {
+            ++retval;
+            return true;
+          } );
+      return retval;
+    }
+
+    inline rank_type
+    indegree( id_type id ) const
+    {
+      rank_type retval = 0;
+      this->for_each_edges_in(
+          id,
+          [&retval]( id_type, linktype_type ) {
+            ++retval;
+            return true;
+          } );
+      return retval;
+    }
+
+    /**
+     *  @brief  Add an empty path to the overlay.
+     *
+     *  @param  name The path name.
+     *  @return The ID of the added path.
+     */
+    inline id_type
+    add_path( string_type name )
+    {
+      id_type pid = this->first_new_pid + this->added_paths.size();
+      this->added_paths.push_back( { pid, std::move( name ), {} } );
+      return pid;
+    }
+
+    /**
+     *  @brief  Append a node to a path added to the overlay.
+     *
+     *  NOTE: Paths of the base graph cannot be extended.
+     */
+    inline void
+    extend_path( id_type pid, id_type nid, bool reversed=false )
+    {
+      assert( this->has_node( nid ) );
+      if ( pid < this->first_new_pid ) throw std::runtime_error( "extending a path of the base graph" );
+      this->added_path( pid ).steps.emplace_back( nid, reversed );
+    }
+
+    inline bool
+    has_path( id_type pid ) const
+    {
+      if ( pid >= this->first_new_pid ) {
+        return static_cast< size_type >( pid - this->first_new_pid ) < this->added_paths.size();
+      }
+      return this->base->has_path( pid );
+    }
+
+    /**
+     *  @brief  Call a callback on each path; base paths first in their rank order.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_path( TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, rank_type, id_type >, "received a non-invocable as callback" );
+
+      if ( !this->base->for_each_path( callback ) ) return false;
+      rank_type rank = this->base->get_path_count();
+      for ( auto const& path : this->added_paths ) {
+        if ( !callback( ++rank, path.id ) ) return false;
+      }
+      return true;
+    }
+
+    inline string_type
+    path_name( id_type pid ) const
+    {
+      assert( this->has_path( pid ) );
+      if ( pid >= this->first_new_pid ) return this->added_path( pid ).name;
+      return this->base->path_name( pid );
+    }
+
+    /**
+     *  @brief  Call a callback on each node of a path skipping removed nodes.
+     *
+     *  The `callback` gets the node ID and its orientation in the path.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_path_node( id_type pid, TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, id_type, bool >, "received a non-invocable as callback" );
+
+      assert( this->has_path( pid ) );
+      if ( pid >= this->first_new_pid ) {
+        for ( auto const& step : this->added_path( pid ).steps ) {
+          if ( this->is_removed( step.first ) ) continue;
+          if ( !callback( step.first, step.second ) ) return false;
+        }
+        return true;
+      }
+      auto path = this->base->path( pid );
+      for ( auto const& node : path ) {
+        id_type id = path.id_of( node );
+        if ( this->is_removed( id ) ) continue;
+        if ( !callback( id, path.is_reverse( node ) ) ) return false;
+      }
+      return true;
+    }
+
+    inline rank_type
+    path_length( id_type pid ) const
+    {
+      rank_type retval = 0;
+      this->for_each_path_node(
+          pid,
+          [&retval]( id_type, bool ) {
+            ++retval;
+            return true;
+          } );
+      return retval;
+    }
+
+    /**
+     *  @brief  Fold the overlay into a new Succinct graph.
+     *
+     *  Node records of the base graph are gathered in parallel, then the
+     *  resulting graph is assembled by inserting the surviving base nodes in
+     *  their rank order followed by the added nodes. The coordinate IDs of
+     *  base nodes are preserved. Paths are kept in their order; removed nodes
+     *  are dropped from them.
+     *
+     *  The overlay is left untouched. In order to continue modifying the
+     *  compacted graph, a new overlay should be created on top of it.
+     *
+     *  @return The compacted Succinct graph.
+     */
+    inline graph_type
+    compact( ) const
+    {
+      using out_edges_type = std::vector< std::pair< link_type, offset_type > >;
+
+      graph_type const& base = *this->base;
+      rank_type base_count = base.get_node_count();
+      std::vector< node_type > nodes( base_count );
+      std::vector< out_edges_type > edges( base_count );
+
+      #pragma omp parallel for schedule( dynamic, 1024 )
+      for ( rank_type rank = 1; rank <= base_count; ++rank ) {
+        id_type id = base.rank_to_id( rank );
+        if ( this->is_removed( id ) ) continue;
+        nodes[ rank - 1 ] = base.get_node_prop( rank );
+        base.for_each_edges_out(
+            id,
+            [&]( id_type to, linktype_type type, auto handle ) {
+              link_type sides = base.make_link( id, to, type );
+              if ( this->is_removed_edge( sides ) ) return true;
+              edges[ rank - 1 ].emplace_back( sides, base.edge_overlap( handle ) );
+              return true;
+            } );
+      }
+
+      dynamic_type d_graph;
+      phmap::flat_hash_map< id_type, id_type > new_ids;
+      auto d_id = [&base, &new_ids]( id_type id ) -> id_type {
+        if ( base.has_node( id ) ) return base.coordinate_id( id );
+        return new_ids[ id ];
+      };
+
+      for ( rank_type rank = 1; rank <= base_count; ++rank ) {
+        id_type id = base.rank_to_id( rank );
+        if ( this->is_removed( id ) ) continue;
+        d_graph.add_node( std::move( nodes[ rank - 1 ] ), base.coordinate_id( id ) );
+      }
+      for ( size_type i = 0; i < this->added_nodes.size(); ++i ) {
+        id_type id = this->first_new_id + i;
+        if ( this->is_removed( id ) ) continue;
+        auto const& added = this->added_nodes[ i ];
+        new_ids[ id ] = d_graph.add_node( added.node, added.ext_id );
+      }
+
+      auto add_edge = [&]( link_type const& sides, offset_type overlap ) {
+        d_graph.add_edge( d_graph.make_link( d_id( base.from_id( sides ) ),
+                                             d_id( base.to_id( sides ) ),
+                                             base.linktype( sides ) ),
+                          edge_type( overlap ) );
+      };
+      for ( auto const& out_edges : edges ) {
+        for ( auto const& edge : out_edges ) add_edge( edge.first, edge.second );
+      }
+      for ( auto const& edge : this->added_overlaps ) add_edge( edge.first, edge.second );
+
+      this->for_each_path(
+          [&]( rank_type, id_type pid ) {
+            id_type new_pid = d_graph.add_path( this->path_name( pid ) );
+            this->for_each_path_node(
+                pid,
+                [&]( id_type id, bool reversed ) {
+                  d_graph.extend_path( new_pid, d_id( id ), reversed );
+                  return true;
+                } );
+            return true;
+          } );
+
+      return graph_type( d_graph, base.is_out_only() );
+    }
+
+  private:
+    /* === DATA MEMBERS === */
+    graph_type const* base;
+    id_type first_new_id;
+    id_type first_new_pid;
+    std::vector< AddedNode > added_nodes;
+    id_set_type removed_nodes;
+    rank_type removed_base_nodes;
+    adj_map_type adj_out;
+    adj_map_type adj_in;
+    overlap_map_type added_overlaps;
+    rank_type added_edge_count;
+    link_set_type removed_edges;
+    std::vector< AddedPath > added_paths;
+
+    /* === METHODS === */
+    inline bool
+    is_added( id_type id ) const
+    {
+      return id >= this->first_new_id &&
+          static_cast< size_type >( id - this->first_new_id ) < this->added_nodes.size();
+    }
+
+    inline bool
+    is_removed( id_type id ) const
+    {
+      return !this->removed_nodes.empty() &&
+          this->removed_nodes.find( id ) != this->removed_nodes.end();
+    }
+
+    inline bool
+    is_removed_edge( link_type const& sides ) const
+    {
+      return !this->removed_edges.empty() &&
+          this->removed_edges.find( sides ) != this->removed_edges.end();
+    }
+
+    inline bool
+    has_base_edge( link_type const& sides ) const
+    {
+      id_type from = this->base->from_id( sides );
+      id_type to = this->base->to_id( sides );
+      if ( !this->base->has_node( from ) || !this->base->has_node( to ) ) return false;
+      if ( this->is_removed_edge( sides ) ) return false;
+      return this->base->has_edge( sides );
+    }
+
+    inline AddedNode const&
+    added_node( id_type id ) const
+    {
+      return this->added_nodes[ id - this->first_new_id ];
+    }
+
+    inline AddedPath const&
+    added_path( id_type pid ) const
+    {
+      return this->added_paths[ pid - this->first_new_pid ];
+    }
+
+    inline AddedPath&
+    added_path( id_type pid )
+    {
+      return this->added_paths[ pid - this->first_new_pid ];
+    }
+  };  /* --- end of template class SeqGraphOverlay --- */
+}  /* --- end of namespace gum --- */
+
+#endif  /* --- #ifndef GUM_SEQGRAPH_OVERLAY_HPP__ --- */
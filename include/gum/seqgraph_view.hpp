@@ -0,0 +1,564 @@
+/**
+ *    @file  seqgraph_view.hpp
+ *   @brief  Filtered read-only views over sequence graphs
+ *
+ *  This header file defines `FilteredGraphView` class which hides a subset of
+ *  nodes and edges of a sequence graph without copying it.
+ *
+ *  @author  Ali Ghaffaari (\@cartoonist), <ali.ghaffaari@mpi-inf.mpg.de>
+ *
+ *  @internal
+ *       Created:  Sat Oct 17, 2026  18:40
+ *  Organization:  Max-Planck-Institut fuer Informatik
+ *     Copyright:  Copyright (c) 2026, Ali Ghaffaari
+ *
+ *  This source code is released under the terms of the MIT License.
+ *  See LICENSE file for more information.
+ */
+
+#ifndef  GUM_SEQGRAPH_VIEW_HPP__
+#define  GUM_SEQGRAPH_VIEW_HPP__
+
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+#include <sdsl/bit_vectors.hpp>
+
+#include "seqgraph.hpp"
+
+
+namespace gum {
+  /**
+   *  @brief  Read-only view of a sequence graph restricted to a subset of nodes and edges.
+   *
+   *  The view refers to an immutable graph (the base graph) and keeps a node mask
+   *  over the node ranks of the base graph, and optionally an edge predicate. A
+   *  node is in the view if its bit is set in the mask; an edge is in the view if
+   *  both of its end nodes are and the predicate (if any) accepts it.
+   *
+   *  The view exposes the read-only interface of the graphs; so the algorithms in
+   *  `seqgraph_interface.hpp` run on it as is. Node IDs are the ones of the base
+   *  graph, while node ranks are renumbered to [1, node_count] by rank/select
+   *  supports on the mask; so rank-indexed arrays of the algorithms are as large
+   *  as the view. Paths are those of the base graph; their steps on hidden nodes
+   *  can be recognised by `has_node`.
+   *
+   *  NOTE: The base graph should outlive the view and should not be modified
+   *  while the view is in use.
+   */
+  template< typename TGraph >
+  class FilteredGraphView {
+  public:
+    /* === TYPEDEFS === */
+    using graph_type = TGraph;
+    using spec_type = typename graph_type::spec_type;
+    using dir_type = typename graph_type::dir_type;
+    using trait_type = typename graph_type::trait_type;
+    using id_type = typename graph_type::id_type;
+    using offset_type = typename graph_type::offset_type;
+    using rank_type = typename graph_type::rank_type;
+    using size_type = typename graph_type::size_type;
+    using string_type = typename graph_type::string_type;
+    using side_type = typename graph_type::side_type;
+    using link_type = typename graph_type::link_type;
+    using linktype_type = typename graph_type::linktype_type;
+    using coordinate_type = typename graph_type::coordinate_type;
+    using dynamic_type = typename graph_type::dynamic_type;
+    using path_type = typename graph_type::path_type;
+    using seq_const_reference = typename graph_type::seq_const_reference;
+    using mask_type = sdsl::bit_vector;
+    using rank_map_type = typename mask_type::rank_1_type;
+    using id_map_type = typename mask_type::select_1_type;
+    using edge_predicate_type = std::function< bool( id_type, id_type, linktype_type ) >;
+
+    /* === LIFECYCLE === */
+    /**
+     *  @brief  Construct a view of `base` by a node mask and an optional edge predicate.
+     *
+     *  @param  base The base graph.
+     *  @param  mask A bit vector whose bit `rank - 1` is set if the node of rank
+     *               `rank` in the base graph is in the view. Its size is the
+     *               maximum rank of the base graph (see `get_max_rank`); the bits
+     *               of removed nodes in a non-compact base graph are ignored.
+     *  @param  edge_pred A predicate on the out-going node ID, the in-coming node ID
+     *                    and the link type of an edge; all edges if empty.
+     */
+    FilteredGraphView( graph_type const& base, mask_type mask,
+                       edge_predicate_type edge_pred={} )
+      : base( &base ), mask( std::move( mask ) ), edge_pred( std::move( edge_pred ) )
+    {
+      if ( this->mask.size() != this->base->get_max_rank() ) {
+        throw std::runtime_error( "node mask size differs from the maximum node rank" );
+      }
+      if ( this->mask.size() != this->base->get_node_count() ) {
+        for ( rank_type rank = 1; rank <= this->mask.size(); ++rank ) {
+          if ( this->base->rank_to_id( rank ) == 0 ) this->mask[ rank - 1 ] = 0;
+        }
+      }
+      sdsl::util::init_support( this->rank_map, &this->mask );
+      sdsl::util::init_support( this->id_map, &this->mask );
+      this->node_count = this->rank_map( this->mask.size() );
+      this->edge_count = 0;
+      this->for_each_node(
+          [this]( rank_type, id_type id ) {
+            this->edge_count += this->outdegree( id );
+            return true;
+          } );
+    }
+
+    /* Rank/select supports refer to the mask; so the view is pinned. */
+    FilteredGraphView( FilteredGraphView const& ) = delete;
+    FilteredGraphView& operator=( FilteredGraphView const& ) = delete;
+
+    /* === ACCESSORS === */
+    inline graph_type const&
+    get_base( ) const
+    {
+      return *this->base;
+    }
+
+    inline mask_type const&
+    get_mask( ) const
+    {
+      return this->mask;
+    }
+
+    inline rank_type
+    get_node_count( ) const
+    {
+      return this->node_count;
+    }
+
+    /**
+     *  @brief  Return the maximum node rank; i.e. the node count.
+     */
+    inline rank_type
+    get_max_rank( ) const
+    {
+      return this->node_count;
+    }
+
+    inline rank_type
+    get_edge_count( ) const
+    {
+      return this->edge_count;
+    }
+
+    inline rank_type
+    get_path_count( ) const
+    {
+      return this->base->get_path_count();
+    }
+
+    /**
+     *  @brief  Whether incoming edges can be queried without building an index.
+     *
+     *  See `SeqGraph< Succinct >::has_in_index`.
+     */
+    inline bool
+    has_in_index( ) const
+    {
+      if constexpr ( std::is_same< spec_type, Succinct >::value ) {
+        return this->base->has_in_index();
+      }
+      else {
+        return true;
+      }
+    }
+
+    /* === METHODS === */
+    inline id_type
+    id_of( side_type side ) const
+    {
+      return this->base->id_of( side );
+    }
+
+    inline side_type
+    from_side( id_type id, linktype_type type=trait_type::get_default_linktype() ) const
+    {
+      return this->base->from_side( id, type );
+    }
+
+    inline side_type
+    to_side( id_type id, linktype_type type=trait_type::get_default_linktype() ) const
+    {
+      return this->base->to_side( id, type );
+    }
+
+    inline side_type
+    start_side( id_type id ) const
+    {
+      return this->base->start_side( id );
+    }
+
+    inline side_type
+    end_side( id_type id ) const
+    {
+      return this->base->end_side( id );
+    }
+
+    inline side_type
+    opposite_side( side_type side ) const
+    {
+      return this->base->opposite_side( side );
+    }
+
+    template< typename TCallback >
+    inline bool
+    for_each_side( id_type id, TCallback callback ) const
+    {
+      return this->base->for_each_side( id, callback );
+    }
+
+    inline link_type
+    make_link( side_type from, side_type to ) const
+    {
+      return this->base->make_link( from, to );
+    }
+
+    inline link_type
+    make_link( id_type from, id_type to,
+               linktype_type type=trait_type::get_default_linktype() ) const
+    {
+      return this->base->make_link( from, to, type );
+    }
+
+    inline linktype_type
+    linktype( side_type from, side_type to ) const
+    {
+      return this->base->linktype( from, to );
+    }
+
+    inline bool
+    has_node( id_type id ) const
+    {
+      return this->base->has_node( id ) && this->mask[ this->base->id_to_rank( id ) - 1 ];
+    }
+
+    inline bool
+    has_node( side_type side ) const
+    {
+      return this->has_node( this->id_of( side ) );
+    }
+
+    /**
+     *  @brief  Return the rank of a node in the view.
+     *
+     *  NOTE: The node should be in the view.
+     */
+    inline rank_type
+    id_to_rank( id_type id ) const
+    {
+      assert( this->has_node( id ) );
+      return this->rank_map( this->base->id_to_rank( id ) );
+    }
+
+    inline id_type
+    rank_to_id( rank_type rank ) const
+    {
+      assert( 0 < rank && rank <= this->node_count );
+      return this->base->rank_to_id( this->id_map( rank ) + 1 );
+    }
+
+    inline auto
+    coordinate_id( id_type id ) const
+    {
+      return this->base->coordinate_id( id );
+    }
+
+    template< typename TExtId >
+    inline id_type
+    id_by_coordinate( TExtId const& ext_id ) const
+    {
+      return this->base->id_by_coordinate( ext_id );
+    }
+
+    /**
+     *  @brief  Call a callback on each node in the view in their rank order.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_node( TCallback callback, rank_type s_rank=1 ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, rank_type, id_type >, "received a non-invocable as callback" );
+
+      for ( rank_type rank = s_rank; rank <= this->node_count; ++rank ) {
+        if ( !callback( rank, this->rank_to_id( rank ) ) ) return false;
+      }
+      return true;
+    }
+
+    inline seq_const_reference
+    node_sequence( id_type id ) const
+    {
+      assert( this->has_node( id ) );
+      return this->base->node_sequence( id );
+    }
+
+    inline offset_type
+    node_length( id_type id ) const
+    {
+      assert( this->has_node( id ) );
+      return this->base->node_length( id );
+    }
+
+    template< typename TOutputIt >
+    inline TOutputIt
+    extract_node_sequence( id_type id, offset_type begin_pos, offset_type end_pos,
+                           TOutputIt d_first ) const
+    {
+      assert( this->has_node( id ) );
+      return this->base->extract_node_sequence( id, begin_pos, end_pos, d_first );
+    }
+
+    /**
+     *  @brief  Return the properties of the node of `rank` in the view.
+     */
+    inline decltype( auto )
+    get_node_prop( rank_type rank ) const
+    {
+      return this->base->get_node_prop( this->id_map( rank ) + 1 );
+    }
+
+    inline bool
+    has_edge( id_type from, id_type to,
+              linktype_type type=trait_type::get_default_linktype() ) const
+    {
+      return this->base->has_edge( this->from_side( from, type ), this->to_side( to, type ) ) &&
+          this->is_visible( from, to, type );
+    }
+
+    inline bool
+    has_edge( side_type from, side_type to ) const
+    {
+      return this->has_edge( this->id_of( from ), this->id_of( to ), this->linktype( from, to ) );
+    }
+
+    inline bool
+    has_edge( link_type sides ) const
+    {
+      return this->has_edge( this->base->from_id( sides ), this->base->to_id( sides ),
+                             this->base->linktype( sides ) );
+    }
+
+    inline bool
+    has_edge_overlaps( ) const
+    {
+      return this->base->has_edge_overlaps();
+    }
+
+    inline offset_type
+    edge_overlap( id_type from, id_type to,
+                  linktype_type type=trait_type::get_default_linktype() ) const
+    {
+      return this->base->edge_overlap( from, to, type );
+    }
+
+    inline offset_type
+    edge_overlap( side_type from, side_type to ) const
+    {
+      return this->base->edge_overlap( from, to );
+    }
+
+    inline offset_type
+    edge_overlap( link_type sides ) const
+    {
+      return this->base->edge_overlap( sides );
+    }
+
+    /**
+     *  @brief  Call a `callback` on each outgoing edges from `from` side in the view.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_edges_out( side_type from, TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, side_type >, "received a non-invocable as callback" );
+
+      if ( !this->has_node( from ) ) return true;
+      return this->base->for_each_edges_out(
+          from,
+          [this, from, &callback]( side_type to ) {
+            if ( !this->is_visible( this->id_of( from ), this->id_of( to ), this->linktype( from, to ) ) ) {
+              return true;
+            }
+            return callback( to );
+          } );
+    }
+
+    /**
+     *  @brief  Call a `callback` on each outgoing edges from each side of a node in the view.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_edges_out( id_type id, TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type >, "received a non-invocable as callback" );
+
+      if ( !this->has_node( id ) ) return true;
+      return this->base->for_each_edges_out(
+          id,
+          [this, id, &callback]( id_type to, linktype_type type ) {
+            if ( !this->is_visible( id, to, type ) ) return true;
+            return callback( to, type );
+          } );
+    }
+
+    /**
+     *  @brief  Call a `callback` on each incoming edges to `to` side in the view.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_edges_in( side_type to, TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, side_type >, "received a non-invocable as callback" );
+
+      if ( !this->has_node( to ) ) return true;
+      return this->base->for_each_edges_in(
+          to,
+          [this, to, &callback]( side_type from ) {
+            if ( !this->is_visible( this->id_of( from ), this->id_of( to ), this->linktype( from, to ) ) ) {
+              return true;
+            }
+            return callback( from );
+          } );
+    }
+
+    /**
+     *  @brief  Call a `callback` on each incoming edges to each side of a node in the view.
+     */
+    template< typename TCallback >
+    inline bool
+    for_each_edges_in( id_type id, TCallback callback ) const
+    {
+      static_assert( std::is_invocable_r_v< bool, TCallback, id_type, linktype_type >, "received a non-invocable as callback" );
+
+      if ( !this->has_node( id ) ) return true;
+      return this->base->for_each_edges_in(
+          id,
+          [this, id, &callback]( id_type from, linktype_type type ) {
+            if ( !this->is_visible( from, id, type ) ) return true;
+            return callback( from, type );
+          } );
+    }
+
+    inline rank_type
+    outdegree( id_type id ) const
+    {
+      if ( this->all_edges_visible() ) return this->base->outdegree( id );
+      rank_type retval = 0;
+      this->for_each_edges_out(
+          id,
+          [&retval]( id_type, linktype_type ) {
+            ++retval;
+            return true;
+          } );
+      return retval;
+    }
+
+    inline rank_type
+    indegree( id_type id ) const
+    {
+      if ( this->all_edges_visible() ) return this->base->indegree( id );
+      rank_type retval = 0;
+      this->for_each_edges_in(
+          id,
+          [&retval]( id_type, linktype_type ) {
+            ++retval;
+            return true;
+          } );
+      return retval;
+    }
+
+    inline bool
+    has_path( id_type pid ) const
+    {
+      return this->base->has_path( pid );
+    }
+
+    template< typename TCallback >
+    inline bool
+    for_each_path( TCallback callback ) const
+    {
+      return this->base->for_each_path( callback );
+    }
+
+    inline decltype( auto )
+    path( id_type pid ) const
+    {
+      return this->base->path( pid );
+    }
+
+    inline decltype( auto )
+    path_name( id_type pid ) const
+    {
+      return this->base->path_name( pid );
+    }
+
+    inline rank_type
+    path_length( id_type pid ) const
+    {
+      return this->base->path_length( pid );
+    }
+
+  private:
+    /* === DATA MEMBERS === */
+    graph_type const* base;
+    mask_type mask;
+    rank_map_type rank_map;
+    id_map_type id_map;
+    edge_predicate_type edge_pred;
+    rank_type node_count;
+    rank_type edge_count;
+
+    /* === METHODS === */
+    /**
+     *  @brief  Whether an edge of the base graph is in the view.
+     */
+    inline bool
+    is_visible( id_type from, id_type to, linktype_type type ) const
+    {
+      if ( !this->has_node( from ) || !this->has_node( to ) ) return false;
+      return !this->edge_pred || this->edge_pred( from, to, type );
+    }
+
+    /**
+     *  @brief  Whether the view has all edges of the base graph between its nodes.
+     *
+     *  It is the case if there is neither a hidden node nor an edge predicate.
+     */
+    inline bool
+    all_edges_visible( ) const
+    {
+      return !this->edge_pred && this->node_count == this->mask.size();
+    }
+  };  /* --- end of template class FilteredGraphView --- */
+
+  namespace util {
+    /**
+     *  @brief  Make a node mask of the nodes on a set of paths.
+     *
+     *  @param  graph A sequence graph.
+     *  @param  pids A container of path IDs.
+     *  @return A bit vector over node ranks to construct a `FilteredGraphView`.
+     */
+    template< typename TGraph, typename TContainer >
+    inline sdsl::bit_vector
+    path_node_mask( TGraph const& graph, TContainer const& pids )
+    {
+      sdsl::bit_vector mask( graph.get_max_rank(), 0 );
+      for ( auto const& pid : pids ) {
+        auto const& path = graph.path( pid );
+        for ( auto it = path.begin(); it != path.end(); ++it ) {
+          auto id = path.id_of( *it );
+          if ( !graph.has_node( id ) ) continue;  // removed step
+          mask[ graph.id_to_rank( id ) - 1 ] = 1;
+        }
+      }
+      return mask;
+    }
+  }  /* --- end of namespace util --- */
+}  /* --- end of namespace gum --- */
+
+#endif  /* --- #ifndef GUM_SEQGRAPH_VIEW_HPP__ --- */
@@ -160,6 +160,39 @@ namespace gum {
                  str.begin() );  // `StringView` is a `char` view
     }
 
+    /**
+     *  @brief  Complement of a nucleotide character.
+     *
+     *  Case is preserved and any character other than `ACGTacgt` is returned
+     *  unchanged (e.g. `N`).
+     */
+    inline char
+    complement( char c )
+    {
+      switch ( c ) {
+        case 'A': return 'T';
+        case 'C': return 'G';
+        case 'G': return 'C';
+        case 'T': return 'A';
+        case 'a': return 't';
+        case 'c': return 'g';
+        case 'g': return 'c';
+        case 't': return 'a';
+        default: return c;
+      }
+    }
+
+    /**
+     *  @brief  Reverse complement the characters in [first, last) in place.
+     */
+    template< typename TBidirIt >
+    inline void
+    reverse_complement( TBidirIt first, TBidirIt last )
+    {
+      std::reverse( first, last );
+      std::transform( first, last, first, []( char c ) { return complement( c ); } );
+    }
+
     template< typename TIter >
     inline std::size_t
     length_sum( TIter begin, TIter end )
@@ -232,7 +265,7 @@ namespace gum {
       }
 
       inline bool
-      operator==( std::string const& str ) const
+      operator==( std::string_view str ) const
       {
         return std::equal( str.begin(), str.end(), this->begin(),
                            []( auto const& l, auto const& r ) {
@@ -258,6 +291,13 @@ namespace gum {
     return right == left;
   }
 
+  template< typename TAlphabet >
+  inline bool
+  operator==( std::string_view left, String< TAlphabet > const& right )
+  {
+    return right == left;
+  }
+
   template< typename TAlphabet >
   inline bool
   operator==( const char* left, String< TAlphabet > const& right )
@@ -415,6 +455,13 @@ namespace gum {
     return right == left;
   }
 
+  template< typename TString >
+  inline bool
+  operator==( std::string_view left, StringView< TString > const& right )
+  {
+    return right == left;
+  }
+
   template< typename TString >
   inline bool
   operator==( const char* left, StringView< TString > const& right )
@@ -650,13 +697,39 @@ namespace gum {
     inline value_type
     extract( size_type begin_pos, size_type end_pos ) const
     {
-      auto biter = this->strset.begin() + begin_pos;
-      auto eiter = this->strset.begin() + end_pos;
       value_type elem( end_pos - begin_pos, '\0' );
-      util::decode( biter, eiter, elem.begin(), alphabet_type() );
+      this->extract( begin_pos, end_pos, elem.begin() );
       return elem;
     }
 
+    /**
+     *  @brief  Decode the characters in [begin_pos, end_pos) into `d_first`.
+     *
+     *  The packed characters are read a machine word at a time rather than
+     *  one int vector element at a time.
+     *
+     *  @return Output iterator to the element past the last one written.
+     */
+    template< typename TOutputIt >
+    inline TOutputIt
+    extract( size_type begin_pos, size_type end_pos, TOutputIt d_first ) const
+    {
+      constexpr uint8_t width = alphabet_type::width;
+      constexpr size_type per_word = 64 / width;
+      constexpr uint64_t mask = ( width < 64 ) ? ( ( 1ULL << ( width % 64 ) ) - 1 ) : ~0ULL;
+
+      assert( begin_pos <= end_pos && end_pos <= this->strset.size() );
+      while ( begin_pos < end_pos ) {
+        size_type n = std::min( per_word, end_pos - begin_pos );
+        uint64_t word = this->strset.get_int( begin_pos * width, n * width );
+        for ( size_type i = 0; i < n; ++i, word >>= ( width % 64 ) ) {
+          *d_first++ = alphabet_type::comp2char( word & mask );
+        }
+        begin_pos += n;
+      }
+      return d_first;
+    }
+
     inline void
     push_back( value_type const& str )
     {
@@ -743,13 +816,14 @@ namespace gum {
      *  NOTE: It does not initialise the rank/select supports. Those should be
      *        done afterwards.
      *
-     *  @param  str A string.
+     *  @param  str A string (or a string view).
      *  @param  pos Put the given string in this position in the `strset`.
      *  @return The location immediately after the last character copied in the
      *          `strset`.
      */
+    template< typename TString >
     inline size_type
-    put( value_type const& str, size_type pos )
+    put( TString const& str, size_type pos )
     {
       assert( pos < this->strset.size() );
       auto citer = this->strset.begin() + pos;
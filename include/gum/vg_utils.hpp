@@ -25,6 +25,10 @@
 #define  GUM_VG_UTILS_HPP__
 
 #include <string>
+#include <vector>
+#include <iterator>
+#include <utility>
+#include <unordered_map>
 
 #include "coordinate.hpp"
 #include "iterators.hpp"
@@ -176,6 +180,29 @@ namespace gum {
               typename=std::enable_if_t< std::is_same< typename TGraph::spec_type, Dynamic >::value > >
     inline void
     add_edge( TGraph& graph, TVGEdge const& edge, VGFormat, TCoordinate&& coord={}, bool force=false )
+    {
+      auto sides_edge = make_edge( graph, edge, VGFormat{}, coord, force );
+      graph.add_edge( sides_edge.first, sides_edge.second );
+    }
+
+    /**
+     *  @brief  Make the link and edge property of an external edge (vg overload).
+     *
+     *  @param  graph Graph of any native type with Dynamic spec tag
+     *  @param  edge External edge
+     *  @param  tag Format specifier tag
+     *  @param  coord Coorindate system converting the given node ids to graph local ids
+     *  @param  force Force node creation if any adjacent node does not exist in the graph
+     *  @return The pair of the link and the edge property to be added to the graph.
+     *
+     *  The adjacent nodes are created (if forced) but the edge itself is not added.
+     */
+    template< typename TGraph,
+              typename TVGEdge,
+              typename TCoordinate=VGFormat::DefaultCoord< TGraph >,
+              typename=std::enable_if_t< std::is_same< typename TGraph::spec_type, Dynamic >::value > >
+    inline std::pair< typename TGraph::link_type, typename TGraph::edge_type >
+    make_edge( TGraph& graph, TVGEdge const& edge, VGFormat, TCoordinate&& coord={}, bool force=false )
     {
       using graph_type = TGraph;
       using id_type = typename graph_type::id_type;
@@ -195,9 +222,8 @@ namespace gum {
         sink_id = graph.add_node( sink_id );
         coord( edge.to(), sink_id );
       }
-      graph.add_edge(
-          link_type( src_id, !edge.from_start(), sink_id, edge.to_end() ),
-          edge_type( edge.overlap() ) );
+      return { link_type( src_id, !edge.from_start(), sink_id, edge.to_end() ),
+               edge_type( edge.overlap() ) };
     }
 
     /**
@@ -378,11 +404,48 @@ namespace gum {
     inline void
     extend_graph( TGraph& graph, TVGGraph& other, VGFormat, bool sort=false, TCoordinate&& coord={} )
     {
-      for ( auto const& node : other.node() ) {
-        add_node( graph, node, VGFormat{}, coord, true );
+      using graph_type = TGraph;
+      using id_type = typename graph_type::id_type;
+      using node_type = typename graph_type::node_type;
+      using link_type = typename graph_type::link_type;
+      using edge_type = typename graph_type::edge_type;
+
+      {
+        std::vector< std::pair< node_type, id_type > > nodes;
+        std::vector< VGFormat::nid_t > eids;
+        // Indices in `nodes` of the records seen so far in this batch
+        std::unordered_map< id_type, std::size_t > batch_ids;
+        std::unordered_map< VGFormat::nid_t, std::size_t > batch_eids;
+        nodes.reserve( other.node_size() );
+        eids.reserve( other.node_size() );
+        for ( auto const& node : other.node() ) {
+          id_type id = coord( node.id() );
+          if ( graph.has_node( id ) ) {  // forced update
+            graph.update_node( id, node_type( node.sequence(), node.name() ) );
+            continue;
+          }
+          std::size_t idx = nodes.size();
+          if ( id != 0 ) idx = batch_ids.emplace( id, idx ).first->second;
+          else idx = batch_eids.emplace( node.id(), idx ).first->second;
+          if ( idx != nodes.size() ) {  // forced update of a repeated record
+            nodes[ idx ].first = node_type( node.sequence(), node.name() );
+            continue;
+          }
+          nodes.emplace_back( node_type( node.sequence(), node.name() ), id );
+          eids.push_back( node.id() );
+        }
+        auto eid_itr = eids.begin();
+        graph.add_nodes_bulk( std::make_move_iterator( nodes.begin() ),
+                              std::make_move_iterator( nodes.end() ),
+                              [&coord, &eid_itr]( id_type id ) { coord( *eid_itr++, id ); } );
       }
-      for ( auto const& edge : other.edge() ) {
-        add_edge( graph, edge, VGFormat{}, coord, true );
+      {
+        std::vector< std::pair< link_type, edge_type > > edges;
+        edges.reserve( other.edge_size() );
+        for ( auto const& edge : other.edge() ) {
+          edges.push_back( make_edge( graph, edge, VGFormat{}, coord, true ) );
+        }
+        graph.add_edges_bulk( edges.begin(), edges.end() );
       }
       if ( sort ) {
         graph.sort_nodes();  // first, sort by ids
@@ -0,0 +1,85 @@
+/**
+ *    @file  test_coordinate.cpp
+ *   @brief  Test cases for `coordinate` module.
+ *
+ *  This source file includes test scenarios for `coordinate` module.
+ *
+ *  @author  Ali Ghaffaari (\@cartoonist), <ali.ghaffaari@mpi-inf.mpg.de>
+ *
+ *  @internal
+ *       Created:  Sat Oct 17, 2026  03:10
+ *  Organization:  Max-Planck-Institut fuer Informatik
+ *     Copyright:  Copyright (c) 2019, Ali Ghaffaari
+ *
+ *  This source code is released under the terms of the MIT License.
+ *  See LICENSE file for more information.
+ */
+
+#include <cstdint>
+#include <vector>
+#include <utility>
+
+#include <gum/coordinate.hpp>
+
+#include "test_base.hpp"
+
+
+SCENARIO( "Mapping external IDs by a Dense coordinate system", "[coordinate]" )
+{
+  using coordinate_type = gum::coordinate::DenseBase< std::int64_t >;
+  using lid_type = typename coordinate_type::lid_type;
+  using id_type = typename coordinate_type::id_type;
+
+  GIVEN( "A Dense coordinate system" )
+  {
+    coordinate_type coord;
+
+    WHEN( "IDs are mapped in increasing order of external IDs" )
+    {
+      coord( 10, 1 );
+      coord( 12, 2 );
+      coord( 13, 3 );
+
+      THEN( "They should be mapped back" )
+      {
+        REQUIRE( coord.size() == 4 );
+        REQUIRE( coord( 10 ) == 1 );
+        REQUIRE( coord( 11 ) == 0 );
+        REQUIRE( coord( 12 ) == 2 );
+        REQUIRE( coord( 13 ) == 3 );
+        REQUIRE( coord( 9 ) == 0 );
+        REQUIRE( coord( 14 ) == 0 );
+      }
+    }
+
+    WHEN( "Lower external IDs are mapped after higher ones" )
+    {
+      std::vector< std::pair< lid_type, id_type > > mapped
+          = { { 10, 1 }, { 12, 2 }, { 7, 3 }, { 3, 4 }, { 200, 5 }, { 1, 6 } };
+      for ( auto const& m : mapped ) coord( m.first, m.second );
+
+      THEN( "The IDs mapped earlier should be kept after shifting" )
+      {
+        REQUIRE( coord.size() == 200 );
+        for ( auto const& m : mapped ) REQUIRE( coord( m.first ) == m.second );
+        REQUIRE( coord( 2 ) == 0 );
+        REQUIRE( coord( 11 ) == 0 );
+        REQUIRE( coord( 199 ) == 0 );
+      }
+
+      THEN( "Each external ID should be visited once in increasing order" )
+      {
+        lid_type last = 0;
+        std::size_t count = 0;
+        coord.for_each_element(
+            [&]( lid_type lid, id_type ) {
+              REQUIRE( lid == last + 1 );
+              last = lid;
+              ++count;
+              return true;
+            } );
+        REQUIRE( count == 200 );
+      }
+    }
+  }
+}
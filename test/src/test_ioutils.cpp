@@ -15,6 +15,8 @@
  *  See LICENSE file for more information.
  */
 
+#include <cstdint>
+#include <string>
 #include <vector>
 #include <utility>
 
@@ -661,6 +663,38 @@ SCENARIO( "Sanity check for deserialising a SeqGraph", "[ioutils]" )
       }
     }
 
+#ifdef GUM_INCLUDED_VGIO
+    WHEN( "Extend a Dynamic SeqGraph by a vg/Protobuf graph with a duplicated node record" )
+    {
+      vg::Graph other;
+      auto add_vg_node =
+          [&other]( std::int64_t id, std::string const& seq ) {
+            vg::Node* node = other.add_node();
+            node->set_id( id );
+            node->set_sequence( seq );
+          };
+      add_vg_node( 1, "A" );
+      add_vg_node( 2, "CC" );
+      add_vg_node( 3, "G" );
+      add_vg_node( 2, "TT" );
+      for ( std::int64_t from : { 1, 2 } ) {
+        vg::Edge* edge = other.add_edge();
+        edge->set_from( from );
+        edge->set_to( from + 1 );
+      }
+      gum::util::extend_graph( graph, other, gum::util::VGFormat{} );
+
+      THEN( "The repeated record should update the node added by the first one" )
+      {
+        REQUIRE( graph.get_node_count() == 3 );
+        REQUIRE( graph.get_edge_count() == 2 );
+        REQUIRE( graph.node_sequence( 1 ) == "A" );
+        REQUIRE( graph.node_sequence( 2 ) == "TT" );
+        REQUIRE( graph.node_sequence( 3 ) == "G" );
+      }
+    }
+#endif
+
     WHEN( "Load a Dynamic SeqGraph from a vg file without passing the format tag" )
     {
 #ifdef GUM_IO_PROTOBUF_VG
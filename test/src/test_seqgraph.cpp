@@ -20,6 +20,8 @@
 #include <algorithm>
 #include <numeric>
 #include <random>
+#include <sstream>
+#include <iterator>
 
 #include <gum/graph.hpp>
 #include <gum/io_utils.hpp>
@@ -28,6 +30,27 @@
 #include "test_base.hpp"
 
 
+/**
+ *  @brief  Add `degree` pseudo-random out-edges to each of the nodes 1 to `n`.
+ *
+ *  The edges of node `id` go to `( id * 7 + k * 131 ) % n + 1` for `k` in [1,
+ *  degree]; duplicates are skipped. It gives dense, many-level graphs for
+ *  comparing graph algorithms with their serial counterparts.
+ */
+template< typename TGraph >
+inline void
+add_strided_edges( TGraph& graph, typename TGraph::id_type n,
+                   typename TGraph::id_type degree )
+{
+  using id_type = typename TGraph::id_type;
+  for ( id_type id = 1; id <= n; ++id ) {
+    for ( id_type k = 1; k <= degree; ++k ) {
+      id_type to = ( id * 7 + k * 131 ) % n + 1;
+      if ( !graph.has_edge( graph.make_link( id, to ) ) ) graph.add_edge( graph.make_link( id, to ) );
+    }
+  }
+}
+
 TEMPLATE_SCENARIO( "Generic functionality of DirectedGraph", "[seqgraph][template]",
                    ( gum::DirectedGraph< gum::Dynamic, gum::Directed > ),
                    ( gum::DirectedGraph< gum::Dynamic, gum::Directed, void, 32, 32 > ),
@@ -572,6 +595,61 @@ TEMPLATE_SCENARIO( "Specialised functionality of DirectedGraph", "[seqgraph][tem
           empty_graph_test( sc_graph );
         }
       }
+
+      AND_WHEN( "A Compressed graph is constructed from Succinct one" )
+      {
+        typename graph_type::compressed_type cm_graph( sc_graph, 4 );
+        edges = tmp;
+        update_edges( cm_graph );
+        THEN( "The resulting graph should pass integrity tests" )
+        {
+          integrity_test( cm_graph );
+        }
+      }
+    }
+
+    WHEN( "An out-only Succinct graph is constructed from Dynamic one" )
+    {
+      graph.add_nodes( node_count );
+      auto tmp = edges;
+      update_edges( graph );
+      for ( auto const& edge : edges ) graph.add_edge( edge );
+      succinct_type sc_graph( graph, 0, 0, true );
+      sc_graph.for_each_node( [&nodes]( rank_type rank, id_type id ) {
+                                nodes.push_back( id );
+                                return true;
+                              } );
+      edges = tmp;
+      update_edges( sc_graph );
+      THEN( "The resulting graph should pass integrity tests" )
+      {
+        REQUIRE( sc_graph.is_out_only() );
+        integrity_test( sc_graph );
+      }
+    }
+
+    WHEN( "A Compressed graph is constructed from Dynamic one" )
+    {
+      graph.add_nodes( node_count );
+      auto tmp = edges;
+      update_edges( graph );
+      for ( auto const& edge : edges ) graph.add_edge( edge );
+      typename graph_type::compressed_type cm_graph( graph, 2 );
+      edges = tmp;
+      update_edges( cm_graph );
+      THEN( "The resulting graph should pass integrity tests" )
+      {
+        integrity_test( cm_graph );
+      }
+
+      AND_WHEN( "It is cleared" )
+      {
+        cm_graph.clear();
+        THEN( "The graph should be empty" )
+        {
+          empty_graph_test( cm_graph );
+        }
+      }
     }
   }
 }
@@ -901,6 +979,101 @@ TEMPLATE_SCENARIO( "Specialised functionality of Bidirected DirectedGraph", "[se
           empty_graph_test( sc_graph );
         }
       }
+
+      AND_WHEN( "A Compressed graph is constructed from Succinct one" )
+      {
+        typename graph_type::compressed_type cm_graph( sc_graph, 4 );
+        edges = tmp;
+        update_edges( cm_graph );
+        THEN( "The resulting graph should pass integrity tests" )
+        {
+          integrity_test( cm_graph );
+        }
+      }
+    }
+
+    WHEN( "A Succinct graph is constructed from a Dynamic one with only forward edges" )
+    {
+      using side_type = typename graph_type::side_type;
+
+      graph.add_nodes( node_count );
+      edges = {
+        { 1, true, 2, false },
+        { 1, true, 3, false },
+        { 2, true, 4, false },
+        { 3, true, 4, false },
+        { 4, true, 5, false }
+      };
+      auto tmp = edges;
+      update_edges( graph );
+      for ( auto const& edge : edges ) graph.add_edge( edge );
+      succinct_type sc_graph( graph );
+      edges = tmp;
+      update_edges( sc_graph );
+      THEN( "The link type field should be dropped while edges remain intact" )
+      {
+        REQUIRE( sc_graph.is_forward_only() );
+        REQUIRE( sc_graph.get_edge_count() == edges.size() );
+        for ( auto const& edge : edges ) {
+          REQUIRE( sc_graph.has_edge( edge ) );
+          REQUIRE( !sc_graph.has_edge( sc_graph.from_side( edge ),
+                                       sc_graph.opposite_side( sc_graph.to_side( edge ) ) ) );
+        }
+        sc_graph.for_each_node(
+            [&sc_graph]( rank_type, id_type id ) {
+              sc_graph.for_each_edges_out(
+                  id,
+                  [&sc_graph]( id_type, auto type ) {
+                    REQUIRE( type == sc_graph.get_default_linktype() );
+                    return true;
+                  } );
+              REQUIRE( sc_graph.adjacents_out( sc_graph.start_side( id ) ).empty() );
+              REQUIRE( sc_graph.adjacents_in( sc_graph.end_side( id ) ).empty() );
+              return true;
+            } );
+        auto ibyc = [&sc_graph]( id_type cid ) { return sc_graph.id_by_coordinate( cid ); };
+        auto adjs = sc_graph.adjacents_in( sc_graph.start_side( ibyc( 4 ) ) );
+        std::vector< side_type > truth = { sc_graph.end_side( ibyc( 2 ) ),
+                                           sc_graph.end_side( ibyc( 3 ) ) };
+        REQUIRE( adjs.size() == truth.size() );
+        for ( auto const& side : truth ) {
+          REQUIRE( std::find( adjs.begin(), adjs.end(), side ) != adjs.end() );
+        }
+      }
+
+      AND_WHEN( "A reversing edge is added" )
+      {
+        graph.add_edge( { graph.id_by_coordinate( 5 ), true, graph.id_by_coordinate( 6 ), true } );
+        succinct_type other( graph );
+        THEN( "The link type field should be kept" )
+        {
+          REQUIRE( !other.is_forward_only() );
+        }
+      }
+    }
+
+    WHEN( "A Compressed graph is constructed from Dynamic one" )
+    {
+      graph.add_nodes( node_count );
+      auto tmp = edges;
+      update_edges( graph );
+      for ( auto const& edge : edges ) graph.add_edge( edge );
+      typename graph_type::compressed_type cm_graph( graph, 2 );
+      edges = tmp;
+      update_edges( cm_graph );
+      THEN( "The resulting graph should pass integrity tests" )
+      {
+        integrity_test( cm_graph );
+      }
+
+      AND_WHEN( "It is cleared" )
+      {
+        cm_graph.clear();
+        THEN( "The graph should be empty" )
+        {
+          empty_graph_test( cm_graph );
+        }
+      }
     }
   }
 }
@@ -968,8 +1141,8 @@ SCENARIO( "Specialised functionality of SeqGraph", "[seqgraph]" )
           if ( check_name ) {
             REQUIRE( graph.get_node_prop( 1 ).name == "1" );
             REQUIRE( graph.get_node_prop( 2 ).name == "2" );
-            REQUIRE( graph.get_node_prop( 3 ).name == "4" );
-            REQUIRE( graph.get_node_prop( 4 ).name == "3" );
+            REQUIRE( graph.get_node_prop( 3 ).name == "3" );
+            REQUIRE( graph.get_node_prop( 4 ).name == "4" );
             REQUIRE( graph.get_node_prop( 5 ).name == "5" );
             REQUIRE( graph.get_node_prop( 6 ).name == "6" );
             REQUIRE( graph.get_node_prop( 7 ).name == "7" );
@@ -994,6 +1167,26 @@ SCENARIO( "Specialised functionality of SeqGraph", "[seqgraph]" )
             REQUIRE( graph.edge_overlap( ibyc(5), ibyc(6), graph.linktype( link_type( { ibyc(5), false, ibyc(6), false } ) ) ) == 1 );
             REQUIRE( graph.edge_overlap( ibyc(5), ibyc(7), graph.linktype( link_type( { ibyc(5), false, ibyc(7), false } ) ) ) == 0 );
             REQUIRE( graph.edge_overlap( ibyc(5), ibyc(8), graph.linktype( link_type( { ibyc(5), true, ibyc(8), false } ) ) ) == 0 );
+            rank_type handle_count = 0;
+            graph.for_each_node(
+                [&graph, &handle_count]( rank_type, id_type id ) {
+                  graph.for_each_edges_out(
+                      id,
+                      [&graph, &handle_count, id]( id_type to, auto type, auto handle ) {
+                        REQUIRE( graph.edge_overlap( handle ) == graph.edge_overlap( id, to, type ) );
+                        ++handle_count;
+                        return true;
+                      } );
+                  graph.for_each_edges_in(
+                      id,
+                      [&graph, &handle_count, id]( id_type from, auto type, auto handle ) {
+                        REQUIRE( graph.edge_overlap( handle ) == graph.edge_overlap( from, id, type ) );
+                        ++handle_count;
+                        return true;
+                      } );
+                  return true;
+                } );
+            REQUIRE( handle_count == 2 * graph.get_edge_count() );
           }
           REQUIRE( graph.get_path_count() == path_count );
           REQUIRE( !graph.has_path( 0 ) );
@@ -1050,10 +1243,10 @@ SCENARIO( "Specialised functionality of SeqGraph", "[seqgraph]" )
           REQUIRE( gum::util::position_to_id( graph, 8 ) == ibyc( 1 ) );
           REQUIRE( gum::util::position_to_id( graph, 9 ) == ibyc( 2 ) );
           REQUIRE( gum::util::position_to_id( graph, 10 ) == ibyc( 2 ) );
-          REQUIRE( gum::util::position_to_id( graph, 11 ) == ibyc( 4 ) );
+          REQUIRE( gum::util::position_to_id( graph, 11 ) == ibyc( 3 ) );
           REQUIRE( gum::util::position_to_id( graph, 13 ) == ibyc( 3 ) );
           REQUIRE( gum::util::position_to_id( graph, 14 ) == ibyc( 3 ) );
-          REQUIRE( gum::util::position_to_id( graph, 15 ) == ibyc( 3 ) );
+          REQUIRE( gum::util::position_to_id( graph, 15 ) == ibyc( 4 ) );
           REQUIRE( gum::util::position_to_id( graph, 17 ) == ibyc( 5 ) );
           REQUIRE( gum::util::position_to_id( graph, 23 ) == ibyc( 5 ) );
           REQUIRE( gum::util::position_to_id( graph, 24 ) == ibyc( 6 ) );
@@ -1067,9 +1260,9 @@ SCENARIO( "Specialised functionality of SeqGraph", "[seqgraph]" )
           REQUIRE( gum::util::position_to_offset( graph, 9 ) == 0 );
           REQUIRE( gum::util::position_to_offset( graph, 10 ) == 1 );
           REQUIRE( gum::util::position_to_offset( graph, 11 ) == 0 );
-          REQUIRE( gum::util::position_to_offset( graph, 13 ) == 0 );
-          REQUIRE( gum::util::position_to_offset( graph, 14 ) == 1 );
-          REQUIRE( gum::util::position_to_offset( graph, 15 ) == 2 );
+          REQUIRE( gum::util::position_to_offset( graph, 13 ) == 2 );
+          REQUIRE( gum::util::position_to_offset( graph, 14 ) == 3 );
+          REQUIRE( gum::util::position_to_offset( graph, 15 ) == 0 );
           REQUIRE( gum::util::position_to_offset( graph, 17 ) == 0 );
           REQUIRE( gum::util::position_to_offset( graph, 23 ) == 6 );
           REQUIRE( gum::util::position_to_offset( graph, 24 ) == 0 );
@@ -1080,16 +1273,16 @@ SCENARIO( "Specialised functionality of SeqGraph", "[seqgraph]" )
           REQUIRE( gum::util::position_to_offset( graph, 38 ) == 4 );
           REQUIRE( gum::util::id_to_position( graph, ibyc( 1 ) ) == 0 );
           REQUIRE( gum::util::id_to_position( graph, ibyc( 2 ) ) == 9 );
-          REQUIRE( gum::util::id_to_position( graph, ibyc( 3 ) ) == 13 );
-          REQUIRE( gum::util::id_to_position( graph, ibyc( 4 ) ) == 11 );
+          REQUIRE( gum::util::id_to_position( graph, ibyc( 3 ) ) == 11 );
+          REQUIRE( gum::util::id_to_position( graph, ibyc( 4 ) ) == 15 );
           REQUIRE( gum::util::id_to_position( graph, ibyc( 5 ) ) == 17 );
           REQUIRE( gum::util::id_to_position( graph, ibyc( 6 ) ) == 24 );
           REQUIRE( gum::util::id_to_position( graph, ibyc( 7 ) ) == 28 );
           REQUIRE( gum::util::id_to_position( graph, ibyc( 8 ) ) == 34 );
           REQUIRE( gum::util::id_to_charorder( graph, ibyc( 1 ) ) == 0 );
           REQUIRE( gum::util::id_to_charorder( graph, ibyc( 2 ) ) == 8 );
-          REQUIRE( gum::util::id_to_charorder( graph, ibyc( 3 ) ) == 10 );
-          REQUIRE( gum::util::id_to_charorder( graph, ibyc( 4 ) ) == 9 );
+          REQUIRE( gum::util::id_to_charorder( graph, ibyc( 3 ) ) == 9 );
+          REQUIRE( gum::util::id_to_charorder( graph, ibyc( 4 ) ) == 12 );
           REQUIRE( gum::util::id_to_charorder( graph, ibyc( 5 ) ) == 13 );
           REQUIRE( gum::util::id_to_charorder( graph, ibyc( 6 ) ) == 19 );
           REQUIRE( gum::util::id_to_charorder( graph, ibyc( 7 ) ) == 22 );
@@ -1157,6 +1350,61 @@ SCENARIO( "Specialised functionality of SeqGraph", "[seqgraph]" )
           }
         }
       }
+
+      WHEN( "An out-only Succinct graph is constructed from Dynamic one" )
+      {
+        succinct_type sc_graph( graph, true );
+        THEN( "It should store fewer entries than the full one" )
+        {
+          REQUIRE( sc_graph.is_out_only() );
+          REQUIRE( !sc_graph.has_in_index() );
+          REQUIRE( sc_graph.get_nodes().size() < succinct_type( graph ).get_nodes().size() );
+          REQUIRE( sc_graph.size_in_bytes() < succinct_type( graph ).size_in_bytes() );
+        }
+
+        THEN( "The resulting graph should pass integrity tests" )
+        {
+          integrity_test( sc_graph );
+          succinct_test( sc_graph );
+          REQUIRE( sc_graph.has_in_index() );
+        }
+
+        AND_WHEN( "Its in-edges index is built explicitly and then it is copied" )
+        {
+          auto bytes = sc_graph.size_in_bytes();
+          sc_graph.build_in_index();
+          succinct_type other( sc_graph );
+          THEN( "The copy should pass integrity tests" )
+          {
+            REQUIRE( other.has_in_index() );
+            REQUIRE( other.size_in_bytes() > bytes );
+            integrity_test( other );
+            succinct_test( other );
+          }
+        }
+
+        AND_WHEN( "Its in-degrees are queried concurrently" )
+        {
+          auto nof_nodes = static_cast< long long int >( sc_graph.get_node_count() );
+          std::vector< std::size_t > degrees( 2 * nof_nodes, 0 );
+#pragma omp parallel for
+          for ( long long int i = 0; i < nof_nodes; ++i ) {
+            auto id = sc_graph.rank_to_id( i + 1 );
+            degrees[ 2 * i ] = sc_graph.indegree( { id, false } );
+            degrees[ 2 * i + 1 ] = sc_graph.indegree( { id, true } );
+          }
+          THEN( "They should match the ones of the full graph" )
+          {
+            succinct_type full( graph );
+            REQUIRE( sc_graph.has_in_index() );
+            for ( long long int i = 0; i < nof_nodes; ++i ) {
+              auto id = full.rank_to_id( i + 1 );
+              REQUIRE( degrees[ 2 * i ] == full.indegree( { id, false } ) );
+              REQUIRE( degrees[ 2 * i + 1 ] == full.indegree( { id, true } ) );
+            }
+          }
+        }
+      }
     }
 
     WHEN( "Loaded a Succinct SeqGraph from a file in GFA 2.0 format" )
@@ -1579,3 +1827,1984 @@ SCENARIO( "Topological sort", "[seqgraph]" )
     }
   }
 }
+
+SCENARIO( "Topological order by Kahn's algorithm", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using id_type = typename graph_type::id_type;
+  using rank_type = typename graph_type::rank_type;
+  using node_type = typename graph_type::node_type;
+
+  auto ids_of =
+      []( auto const& order ) {
+        std::vector< id_type > ids;
+        for ( auto const& p : order ) ids.push_back( p.second );
+        return ids;
+      };
+
+  GIVEN( "A DAG whose levels have more than one node" )
+  {
+    graph_type graph;
+    for ( id_type id : { 2, 1, 3, 5, 4, 6 } ) graph.add_node( node_type( "A" ), id );
+    graph.add_edge( graph.make_link( 1, 3 ) );
+    graph.add_edge( graph.make_link( 2, 3 ) );
+    graph.add_edge( graph.make_link( 3, 4 ) );
+    graph.add_edge( graph.make_link( 3, 5 ) );
+    graph.add_edge( graph.make_link( 4, 6 ) );
+    graph.add_edge( graph.make_link( 5, 6 ) );
+
+    WHEN( "Its topological order is computed" )
+    {
+      auto [ order, dag ] = gum::util::kahn_topological_order( graph );
+
+      THEN( "The nodes in each level should be ordered by their ranks" )
+      {
+        REQUIRE( dag );
+        REQUIRE( ids_of( order ) == std::vector< id_type >( { 2, 1, 3, 5, 4, 6 } ) );
+        for ( auto const& p : order ) REQUIRE( graph.id_to_rank( p.second ) == p.first );
+      }
+    }
+
+    AND_GIVEN( "An edge closing a cycle" )
+    {
+      graph.add_edge( graph.make_link( 6, 3 ) );
+
+      WHEN( "Its topological order is computed" )
+      {
+        auto [ order, dag ] = gum::util::kahn_topological_order( graph );
+
+        THEN( "The cycle should be reported and its nodes left out" )
+        {
+          REQUIRE( !dag );
+          REQUIRE( ids_of( order ) == std::vector< id_type >( { 2, 1 } ) );
+        }
+
+        THEN( "The general topological order should still include all nodes" )
+        {
+          auto [ all, all_dag ] = gum::util::topological_sort_order( graph );
+          REQUIRE( !all_dag );
+          REQUIRE( all.size() == graph.get_node_count() );
+        }
+      }
+    }
+  }
+
+  GIVEN( "A DAG with a level large enough to be expanded in parallel" )
+  {
+    graph_type graph;
+    id_type width = 3000;
+    graph.add_node( node_type( "A" ), 1 );
+    for ( id_type id = width + 1; id > 1; --id ) graph.add_node( node_type( "C" ), id );
+    graph.add_node( node_type( "G" ), width + 2 );
+    for ( id_type id = 2; id <= width + 1; ++id ) {
+      graph.add_edge( graph.make_link( 1, id ) );
+      graph.add_edge( graph.make_link( id, width + 2 ) );
+    }
+
+    WHEN( "It is topologically sorted" )
+    {
+      auto [ order, dag ] = gum::util::kahn_topological_order( graph );
+      bool sorted_dag = gum::util::topological_sort( graph );
+
+      THEN( "The order should follow the levels and then the ranks" )
+      {
+        REQUIRE( dag );
+        REQUIRE( sorted_dag );
+        REQUIRE( order.size() == static_cast< std::size_t >( width + 2 ) );
+        REQUIRE( order.front().second == 1 );
+        REQUIRE( order.back().second == width + 2 );
+        for ( rank_type i = 2; i < order.size(); ++i ) {
+          REQUIRE( order[ i - 1 ].first < order[ i ].first );
+        }
+        REQUIRE( gum::util::ranks_in_topological_order( graph ) );
+      }
+    }
+  }
+}
+
+SCENARIO( "Computing BFS levels from a set of source nodes", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using succinct_type = typename graph_type::succinct_type;
+  using id_type = typename graph_type::id_type;
+  using rank_type = typename graph_type::rank_type;
+  using node_type = typename graph_type::node_type;
+
+  constexpr const rank_type UNREACHED = std::numeric_limits< rank_type >::max();
+
+  auto serial_levels =
+      [UNREACHED]( auto const& graph, std::vector< id_type > const& sources ) {
+        std::vector< rank_type > levels( graph.get_max_rank(), UNREACHED );
+        std::vector< id_type > queue;
+        for ( auto id : sources ) {
+          auto& level = levels[ graph.id_to_rank( id ) - 1 ];
+          if ( level == UNREACHED ) { level = 0; queue.push_back( id ); }
+        }
+        for ( std::size_t i = 0; i < queue.size(); ++i ) {
+          auto level = levels[ graph.id_to_rank( queue[ i ] ) - 1 ];
+          graph.for_each_edges_out(
+              queue[ i ],
+              [&]( id_type to, auto ) {
+                auto& next = levels[ graph.id_to_rank( to ) - 1 ];
+                if ( next == UNREACHED ) { next = level + 1; queue.push_back( to ); }
+                return true;
+              } );
+        }
+        return levels;
+      };
+
+  GIVEN( "A graph with dense levels and a node unreachable from the sources" )
+  {
+    graph_type graph;
+    id_type n = 5000;
+    for ( id_type id = 1; id <= n + 1; ++id ) graph.add_node( node_type( "A" ), id );
+    add_strided_edges( graph, n, 3 );
+    std::vector< id_type > sources = { 42, 4242, 42 };
+
+    WHEN( "BFS levels are computed in Dynamic and Succinct graphs" )
+    {
+      auto expected = serial_levels( graph, sources );
+      succinct_type sgraph( graph );
+      succinct_type out_only( graph, true );
+
+      THEN( "They should be equal to the ones found by serial BFS" )
+      {
+        REQUIRE( expected[ graph.id_to_rank( 42 ) - 1 ] == 0 );
+        REQUIRE( expected[ graph.id_to_rank( n + 1 ) - 1 ] == UNREACHED );
+        REQUIRE( *std::max_element( expected.begin(), expected.begin() + n ) > 2 );
+        REQUIRE( gum::util::bfs_levels( graph, sources ) == expected );
+        auto ssources = sources;
+        for ( auto& id : ssources ) id = sgraph.id_by_coordinate( id );
+        REQUIRE( gum::util::bfs_levels( sgraph, ssources ) == expected );
+        for ( std::size_t i = 0; i < sources.size(); ++i ) ssources[ i ] = out_only.id_by_coordinate( sources[ i ] );
+        REQUIRE( gum::util::bfs_levels( out_only, ssources ) == expected );
+      }
+    }
+
+    WHEN( "Some nodes are removed" )
+    {
+      for ( id_type id : std::vector< id_type >( { 7, 1000, 2500, n } ) ) graph.remove_node( id );
+      auto levels = gum::util::bfs_levels( graph, sources );
+
+      THEN( "Levels should be given up to the maximum rank and match serial BFS" )
+      {
+        REQUIRE( !graph.is_compact() );
+        REQUIRE( levels.size() == graph.get_max_rank() );
+        REQUIRE( levels == serial_levels( graph, sources ) );
+        REQUIRE( levels[ n - 1 ] == UNREACHED );
+      }
+    }
+
+    WHEN( "There is no source node" )
+    {
+      auto levels = gum::util::bfs_levels( graph, std::vector< id_type >() );
+
+      THEN( "No node should be reached" )
+      {
+        REQUIRE( levels == std::vector< rank_type >( graph.get_node_count(), UNREACHED ) );
+      }
+    }
+  }
+}
+
+SCENARIO( "Finding neighbourhoods of many source nodes by multi-source BFS", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using succinct_type = typename graph_type::succinct_type;
+  using id_type = typename graph_type::id_type;
+  using rank_type = typename graph_type::rank_type;
+  using node_type = typename graph_type::node_type;
+
+  auto neighbourhood =
+      []( auto const& graph, id_type source, rank_type max_level ) {
+        std::vector< std::pair< id_type, rank_type > > queue = { { source, 0 } };
+        std::vector< bool > seen( graph.get_max_rank() + 1, false );
+        seen[ graph.id_to_rank( source ) ] = true;
+        for ( std::size_t i = 0; i < queue.size(); ++i ) {
+          auto [ id, level ] = queue[ i ];
+          if ( level == max_level ) continue;
+          graph.for_each_edges_out(
+              id,
+              [&, level=level]( id_type to, auto ) {
+                auto rank = graph.id_to_rank( to );
+                if ( !seen[ rank ] ) { seen[ rank ] = true; queue.push_back( { to, level + 1 } ); }
+                return true;
+              } );
+        }
+        std::vector< id_type > ids;
+        for ( rank_type rank = 1; rank < seen.size(); ++rank ) {
+          if ( seen[ rank ] ) ids.push_back( graph.rank_to_id( rank ) );
+        }
+        return ids;
+      };
+
+  GIVEN( "A graph and more source nodes than fit in one batch" )
+  {
+    graph_type graph;
+    id_type n = 2000;
+    for ( id_type id = 1; id <= n; ++id ) graph.add_node( node_type( "A" ), id );
+    add_strided_edges( graph, n, 2 );
+    succinct_type sgraph( graph );
+    std::vector< id_type > sources;
+    for ( id_type id = 1; id <= 150; ++id ) sources.push_back( ( id * 37 ) % n + 1 );
+    sources.push_back( sources.front() );
+    std::vector< id_type > ssources;
+    for ( auto id : sources ) ssources.push_back( sgraph.id_by_coordinate( id ) );
+
+    WHEN( "The neighbourhoods within three hops are computed" )
+    {
+      auto result = gum::util::multi_source_bfs( graph, sources, 3 );
+      auto wide = gum::util::multi_source_bfs< 4 >( graph, sources, 3 );
+      auto sresult = gum::util::multi_source_bfs( sgraph, ssources, 3 );
+
+      THEN( "They should be equal to the ones found by a BFS from each source" )
+      {
+        REQUIRE( result.size() == sources.size() );
+        for ( std::size_t i = 0; i < sources.size(); ++i ) {
+          auto expected = neighbourhood( graph, sources[ i ], 3 );
+          REQUIRE( expected.size() > 1 );
+          REQUIRE( result[ i ] == expected );
+          REQUIRE( wide[ i ] == expected );
+          REQUIRE( sresult[ i ] == neighbourhood( sgraph, ssources[ i ], 3 ) );
+        }
+      }
+    }
+
+    WHEN( "Some nodes are removed" )
+    {
+      for ( id_type id = 5; id <= n; id += 97 ) graph.remove_node( id );
+      std::vector< id_type > kept;
+      for ( auto id : sources ) if ( graph.has_node( id ) ) kept.push_back( id );
+      auto result = gum::util::multi_source_bfs( graph, kept, 3 );
+
+      THEN( "The neighbourhoods should skip the removed nodes" )
+      {
+        REQUIRE( !graph.is_compact() );
+        REQUIRE( result.size() == kept.size() );
+        for ( std::size_t i = 0; i < kept.size(); ++i ) {
+          REQUIRE( result[ i ] == neighbourhood( graph, kept[ i ], 3 ) );
+        }
+      }
+    }
+
+    WHEN( "The neighbourhoods within zero hops are computed" )
+    {
+      auto result = gum::util::multi_source_bfs( graph, sources, 0 );
+
+      THEN( "Each should only contain its source" )
+      {
+        for ( std::size_t i = 0; i < sources.size(); ++i ) {
+          REQUIRE( result[ i ] == std::vector< id_type >( { sources[ i ] } ) );
+        }
+      }
+    }
+  }
+}
+
+SCENARIO( "Reordering nodes for locality", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using succinct_type = typename graph_type::succinct_type;
+  using id_type = typename graph_type::id_type;
+  using rank_type = typename graph_type::rank_type;
+  using node_type = typename graph_type::node_type;
+  using order_type = std::vector< std::pair< rank_type, id_type > >;
+
+  GIVEN( "A grid graph whose nodes are added in a shuffled order" )
+  {
+    id_type side = 30;
+    std::vector< id_type > ids( side * side );
+    std::iota( ids.begin(), ids.end(), 1 );
+    std::shuffle( ids.begin(), ids.end(), std::mt19937( 7 ) );
+    graph_type graph;
+    for ( auto id : ids ) graph.add_node( node_type( std::string( id % 5 + 1, 'C' ), std::to_string( id ) ), id );
+    for ( id_type id = 1; id <= side * side; ++id ) {
+      if ( id % side != 0 ) graph.add_edge( graph.make_link( id, id + 1 ) );
+      if ( id + side <= side * side ) graph.add_edge( graph.make_link( id, id + side ) );
+    }
+    double initial_span = gum::util::average_edge_span( graph );
+
+    auto check =
+        [&graph, initial_span]( order_type const& order ) {
+          REQUIRE( order.size() == graph.get_node_count() );
+          std::vector< rank_type > ranks;
+          for ( auto const& p : order ) {
+            REQUIRE( graph.id_to_rank( p.second ) == p.first );
+            ranks.push_back( p.first );
+          }
+          std::sort( ranks.begin(), ranks.end() );
+          for ( rank_type rank = 1; rank <= ranks.size(); ++rank ) REQUIRE( ranks[ rank - 1 ] == rank );
+
+          graph_type reordered( graph );
+          gum::util::reorder_nodes( reordered, order );
+          double span = gum::util::average_edge_span( reordered );
+          REQUIRE( span < initial_span / 2 );
+
+          succinct_type sgraph( reordered );
+          REQUIRE( gum::util::average_edge_span( sgraph ) == span );
+          for ( rank_type rank = 1; rank <= order.size(); ++rank ) {
+            id_type id = sgraph.rank_to_id( rank );
+            REQUIRE( sgraph.coordinate_id( id ) == order[ rank - 1 ].second );
+            REQUIRE( sgraph.node_sequence( id ) == graph.node_sequence( order[ rank - 1 ].second ) );
+          }
+        };
+
+    THEN( "Its nodes should be scattered" )
+    {
+      REQUIRE( initial_span > side * side / 4 );
+    }
+
+    WHEN( "Its nodes are reordered by BFS" )
+    {
+      THEN( "Adjacent nodes should be closer" )
+      {
+        check( gum::util::bfs_order( graph ) );
+      }
+    }
+
+    WHEN( "Its nodes are reordered by reverse Cuthill-McKee" )
+    {
+      THEN( "Adjacent nodes should be closer" )
+      {
+        check( gum::util::cuthill_mckee_order( graph ) );
+      }
+    }
+
+    WHEN( "Its nodes are reordered by the Gorder heuristic" )
+    {
+      THEN( "Adjacent nodes should be closer" )
+      {
+        auto order = gum::util::gorder_order( graph );
+        check( order );
+        REQUIRE( order == gum::util::gorder_order( graph ) );
+      }
+    }
+
+    WHEN( "A node is removed" )
+    {
+      graph.remove_node( ids.front() );
+
+      THEN( "Nodes should only be ordered after compaction" )
+      {
+        REQUIRE( gum::util::average_edge_span( graph ) > 0 );
+        REQUIRE_THROWS( gum::util::bfs_order( graph ) );
+        REQUIRE_THROWS( gum::util::cuthill_mckee_order( graph ) );
+        REQUIRE_THROWS( gum::util::gorder_order( graph ) );
+        graph.compact();
+        REQUIRE( gum::util::cuthill_mckee_order( graph ).size() == graph.get_node_count() );
+      }
+    }
+  }
+}
+
+SCENARIO( "Finding weakly connected components", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using succinct_type = typename graph_type::succinct_type;
+  using id_type = typename graph_type::id_type;
+  using rank_type = typename graph_type::rank_type;
+  using node_type = typename graph_type::node_type;
+
+  GIVEN( "A graph with interleaved node ranks, a cyclic component and an isolated node" )
+  {
+    graph_type graph;
+    // Component A: 1 -> 2 -> 3, 1 -> 3; component B: 10 -> 11 -> 12 -> 10; component C: 20.
+    for ( id_type id : { 10, 1, 20, 11, 2, 12, 3 } ) {
+      graph.add_node( node_type( std::string( id % 4 + 1, 'A' ) ), id );
+    }
+    graph.add_edge( graph.make_link( 1, 2 ) );
+    graph.add_edge( graph.make_link( 2, 3 ) );
+    graph.add_edge( graph.make_link( 1, 3 ) );
+    graph.add_edge( graph.make_link( 11, 12 ) );
+    graph.add_edge( graph.make_link( 12, 10 ) );
+    graph.add_edge( graph.make_link( 10, 11 ) );
+
+    auto check =
+        []( auto const& graph ) {
+          auto components = gum::util::connected_components( graph );
+          auto label = [&]( id_type cid ) {
+            return components.labels[ graph.id_to_rank( graph.id_by_coordinate( cid ) ) - 1 ];
+          };
+
+          REQUIRE( components.size() == 3 );
+          REQUIRE( components.first_ranks == std::vector< rank_type >( { 1, 2, 3 } ) );
+          REQUIRE( label( 10 ) == 0 );
+          REQUIRE( label( 11 ) == 0 );
+          REQUIRE( label( 12 ) == 0 );
+          REQUIRE( label( 1 ) == 1 );
+          REQUIRE( label( 2 ) == 1 );
+          REQUIRE( label( 3 ) == 1 );
+          REQUIRE( label( 20 ) == 2 );
+          REQUIRE( components.node_counts == std::vector< rank_type >( { 3, 3, 1 } ) );
+          REQUIRE( components.edge_counts == std::vector< rank_type >( { 3, 3, 0 } ) );
+          REQUIRE( components.sequence_lengths[ 0 ] == 3 + 4 + 1 );
+          REQUIRE( components.sequence_lengths[ 1 ] == 2 + 3 + 4 );
+          REQUIRE( components.sequence_lengths[ 2 ] == 1 );
+        };
+
+    WHEN( "Its components are found" )
+    {
+      THEN( "Nodes should be labelled by their components in both Dynamic and Succinct graphs" )
+      {
+        check( graph );
+        check( succinct_type( graph ) );
+      }
+    }
+
+    WHEN( "A node is removed" )
+    {
+      graph.add_node( node_type( "A" ), 30 );
+      graph.add_edge( graph.make_link( 20, 30 ) );
+      graph.remove_node( 30 );
+      graph.remove_node( 2 );
+
+      THEN( "Components should only be found after compaction" )
+      {
+        REQUIRE_THROWS( gum::util::connected_components( graph ) );
+        graph.compact();
+        auto components = gum::util::connected_components( graph );
+        REQUIRE( components.size() == 3 );
+        REQUIRE( components.node_counts == std::vector< rank_type >( { 3, 2, 1 } ) );
+      }
+    }
+  }
+
+  GIVEN( "A graph with many components" )
+  {
+    graph_type graph;
+    id_type n = 6000;
+    for ( id_type id = 1; id <= n; ++id ) graph.add_node( node_type( "A" ), id );
+    // Node `id` joins the component of `id % 7`, so edges link nodes far apart in rank.
+    for ( id_type id = 8; id <= n; ++id ) graph.add_edge( graph.make_link( id, id - 7 ) );
+
+    WHEN( "Its components are found" )
+    {
+      auto components = gum::util::connected_components( graph );
+
+      THEN( "Each residue class modulo seven should be a component" )
+      {
+        REQUIRE( components.size() == 7 );
+        for ( id_type id = 1; id <= n; ++id ) {
+          REQUIRE( components.labels[ graph.id_to_rank( id ) - 1 ] == static_cast< rank_type >( ( id - 1 ) % 7 ) );
+        }
+        REQUIRE( std::accumulate( components.node_counts.begin(), components.node_counts.end(), rank_type( 0 ) ) == static_cast< rank_type >( n ) );
+        REQUIRE( std::accumulate( components.edge_counts.begin(), components.edge_counts.end(), rank_type( 0 ) ) == static_cast< rank_type >( n - 7 ) );
+      }
+    }
+  }
+}
+
+SCENARIO( "Finding strongly connected components", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using succinct_type = typename graph_type::succinct_type;
+  using id_type = typename graph_type::id_type;
+  using node_type = typename graph_type::node_type;
+
+  GIVEN( "A graph with two cycles and an isolated node" )
+  {
+    graph_type graph;
+    for ( id_type id : { 6, 4, 1, 5, 2, 3 } ) graph.add_node( node_type( "A" ), id );
+    graph.add_edge( graph.make_link( 1, 2 ) );
+    graph.add_edge( graph.make_link( 2, 3 ) );
+    graph.add_edge( graph.make_link( 3, 1 ) );
+    graph.add_edge( graph.make_link( 3, 4 ) );
+    graph.add_edge( graph.make_link( 4, 5 ) );
+    graph.add_edge( graph.make_link( 5, 4 ) );
+
+    auto check =
+        []( auto const& graph ) {
+          auto scc = gum::util::strongly_connected_components( graph );
+          auto label = [&]( id_type cid ) {
+            return scc.labels[ graph.id_to_rank( graph.id_by_coordinate( cid ) ) - 1 ];
+          };
+          REQUIRE( scc.size() == 3 );
+          REQUIRE( label( 1 ) == label( 2 ) );
+          REQUIRE( label( 2 ) == label( 3 ) );
+          REQUIRE( label( 4 ) == label( 5 ) );
+          REQUIRE( label( 1 ) < label( 4 ) );
+          REQUIRE( label( 6 ) != label( 1 ) );
+          REQUIRE( label( 6 ) != label( 4 ) );
+
+          auto condensed = gum::util::condensation( graph, scc );
+          REQUIRE( condensed.get_node_count() == 3 );
+          REQUIRE( condensed.get_edge_count() == 1 );
+          REQUIRE( condensed.has_edge( condensed.make_link( label( 1 ) + 1, label( 4 ) + 1 ) ) );
+        };
+
+    WHEN( "Its strongly connected components are found" )
+    {
+      THEN( "Each cycle should be a component and the condensed graph a DAG" )
+      {
+        check( graph );
+        check( succinct_type( graph ) );
+        check( succinct_type( graph, true ) );
+      }
+    }
+
+    WHEN( "A node is removed" )
+    {
+      auto scc = gum::util::strongly_connected_components( graph );
+      graph.remove_node( 2 );
+
+      THEN( "Components should only be found after compaction" )
+      {
+        REQUIRE_THROWS( gum::util::strongly_connected_components( graph ) );
+        REQUIRE_THROWS( gum::util::condensation( graph, scc ) );
+        graph.compact();
+        auto compacted = gum::util::strongly_connected_components( graph );
+        REQUIRE( compacted.size() == 4 );
+        REQUIRE( gum::util::condensation( graph, compacted ).get_edge_count() == 2 );
+      }
+    }
+  }
+
+  GIVEN( "A bidirected graph with a cycle only in its node-level projection" )
+  {
+    graph_type graph;
+    graph.add_node( node_type( "A" ), 1 );
+    graph.add_node( node_type( "C" ), 2 );
+    graph.add_edge( graph.make_link( 1, 2 ) );
+    graph.add_edge( { 2, true, 1, true } );  // end of 2 to the end of 1; i.e. an inversion
+
+    WHEN( "Its strongly connected components are found over nodes and over sides" )
+    {
+      auto nodes = gum::util::strongly_connected_components( graph );
+      auto sides = gum::util::strongly_connected_components( graph, true );
+
+      THEN( "Nodes should form one component but no oriented walk should return" )
+      {
+        REQUIRE( nodes.size() == 1 );
+        REQUIRE( sides.size() == 4 );
+        REQUIRE( sides.labels.size() == 4 );
+        REQUIRE( gum::util::condensation( graph, sides ).get_edge_count() == 4 );
+      }
+    }
+
+    AND_GIVEN( "An edge closing an oriented cycle" )
+    {
+      graph.add_edge( graph.make_link( 2, 1 ) );
+
+      WHEN( "Its strongly connected components are found over sides" )
+      {
+        auto sides = gum::util::strongly_connected_components( graph, true );
+
+        THEN( "The forward walk and its reverse should be two components" )
+        {
+          auto label = [&]( id_type id, bool side ) {
+            return sides.labels[ 2 * ( graph.id_to_rank( id ) - 1 ) + side ];
+          };
+          REQUIRE( sides.size() == 2 );
+          REQUIRE( label( 1, true ) == label( 2, true ) );
+          REQUIRE( label( 1, false ) == label( 2, false ) );
+          REQUIRE( label( 1, true ) != label( 1, false ) );
+        }
+      }
+    }
+  }
+
+  GIVEN( "A long cycle" )
+  {
+    graph_type graph;
+    id_type n = 300000;
+    for ( id_type id = 1; id <= n; ++id ) graph.add_node( node_type( "A" ), id );
+    for ( id_type id = 1; id < n; ++id ) graph.add_edge( graph.make_link( id, id + 1 ) );
+    graph.add_edge( graph.make_link( n, 1 ) );
+    graph.add_node( node_type( "A" ), n + 1 );
+    graph.add_edge( graph.make_link( n / 2, n + 1 ) );
+
+    WHEN( "Its strongly connected components are found" )
+    {
+      auto scc = gum::util::strongly_connected_components( graph );
+
+      THEN( "All nodes on the cycle should be in one component without exhausting the stack" )
+      {
+        REQUIRE( scc.size() == 2 );
+        REQUIRE( scc.labels[ graph.id_to_rank( n + 1 ) - 1 ] == 1 );
+        REQUIRE( std::count( scc.labels.begin(), scc.labels.end(), 0 ) == n );
+      }
+    }
+  }
+}
+
+SCENARIO( "Traversing oriented nodes of a bidirected graph", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using succinct_type = typename graph_type::succinct_type;
+  using id_type = typename graph_type::id_type;
+  using rank_type = typename graph_type::rank_type;
+  using node_type = typename graph_type::node_type;
+  using side_type = typename graph_type::side_type;
+
+  GIVEN( "A graph with an inversion: 1+ -> 2+ -> 3- -> 4+" )
+  {
+    graph_type graph;
+    for ( id_type id = 1; id <= 4; ++id ) graph.add_node( node_type( "A" ), id );
+    graph.add_edge( { 1, true, 2, false } );
+    graph.add_edge( { 2, true, 3, true } );
+    graph.add_edge( { 3, false, 4, false } );
+
+    auto oriented =
+        []( auto const& graph, std::vector< side_type > walk ) {
+          for ( auto& side : walk ) side.first = graph.id_by_coordinate( side.first );
+          return walk;
+        };
+
+    auto check =
+        [&oriented]( auto const& graph ) {
+          std::vector< side_type > visited;
+          std::vector< rank_type > levels;
+          auto bfs = [&]( std::vector< side_type > const& starts, rank_type max_level ) {
+            visited.clear();
+            levels.clear();
+            gum::util::oriented_bfs_traverse(
+                graph, oriented( graph, starts ),
+                [&]( side_type side, rank_type level ) {
+                  visited.push_back( side );
+                  levels.push_back( level );
+                  return level < max_level;
+                } );
+          };
+
+          bfs( { { 1, true } }, 10 );
+          REQUIRE( visited == oriented( graph, { { 1, true }, { 2, true }, { 3, false }, { 4, true } } ) );
+          REQUIRE( levels == std::vector< rank_type >( { 0, 1, 2, 3 } ) );
+
+          bfs( { { 4, false } }, 10 );
+          REQUIRE( visited == oriented( graph, { { 4, false }, { 3, true }, { 2, false }, { 1, false } } ) );
+
+          bfs( { { 1, true } }, 1 );
+          REQUIRE( visited == oriented( graph, { { 1, true }, { 2, true } } ) );
+
+          std::vector< side_type > discovered;
+          std::vector< side_type > finished;
+          gum::util::oriented_dfs_traverse(
+              graph, oriented( graph, { { 1, true }, { 3, true } } ),
+              [&finished]( side_type side ) { finished.push_back( side ); },
+              [&discovered]( side_type side ) { discovered.push_back( side ); } );
+          REQUIRE( discovered == oriented( graph, { { 1, true }, { 2, true }, { 3, false }, { 4, true },
+                                                    { 3, true }, { 2, false }, { 1, false } } ) );
+          REQUIRE( finished == oriented( graph, { { 4, true }, { 3, false }, { 2, true }, { 1, true },
+                                                  { 1, false }, { 2, false }, { 3, true } } ) );
+        };
+
+    WHEN( "It is traversed from oriented nodes" )
+    {
+      THEN( "Only valid oriented walks should be followed" )
+      {
+        check( graph );
+        check( succinct_type( graph ) );
+      }
+    }
+
+    WHEN( "A node is removed" )
+    {
+      graph.remove_node( 1 );
+
+      THEN( "The remaining oriented nodes should be traversed" )
+      {
+        REQUIRE( !graph.is_compact() );
+        std::vector< side_type > visited;
+        gum::util::oriented_bfs_traverse(
+            graph, std::vector< side_type >{ { 2, true } },
+            [&visited]( side_type side, rank_type ) {
+              visited.push_back( side );
+              return true;
+            } );
+        REQUIRE( visited == std::vector< side_type >( { { 2, true }, { 3, false }, { 4, true } } ) );
+        std::vector< side_type > finished;
+        gum::util::oriented_dfs_traverse(
+            graph, std::vector< side_type >{ { 4, false } },
+            [&finished]( side_type side ) { finished.push_back( side ); } );
+        REQUIRE( finished == std::vector< side_type >( { { 2, false }, { 3, true }, { 4, false } } ) );
+      }
+    }
+  }
+}
+
+SCENARIO( "Spelling path sequences", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using succinct_type = typename graph_type::succinct_type;
+  using id_type = typename graph_type::id_type;
+  using rank_type = typename graph_type::rank_type;
+  using node_type = typename graph_type::node_type;
+  using edge_type = typename graph_type::edge_type;
+
+  auto spell =
+      []( auto const& graph ) {
+        std::vector< std::string > seqs;
+        graph.for_each_path(
+            [&]( rank_type, id_type pid ) {
+              std::string seq;
+              gum::util::path_sequence( graph, pid, std::back_inserter( seq ) );
+              seqs.push_back( seq );
+              return true;
+            } );
+        return seqs;
+      };
+
+  auto fasta =
+      []( auto const& graph, unsigned int threads, std::size_t line_width=0 ) {
+        std::ostringstream oss;
+        gum::util::write_paths_fasta( graph, oss, threads, line_width );
+        return oss.str();
+      };
+
+  GIVEN( "A graph with overlapping edges and paths on both strands" )
+  {
+    graph_type graph;
+    graph.add_node( node_type( "ACGTA" ), 1 );
+    graph.add_node( node_type( "TAGG" ), 2 );
+    graph.add_node( node_type( "ACCC" ), 3 );
+    graph.add_edge( { 1, true, 2, false }, edge_type( 2 ) );
+    graph.add_edge( { 2, true, 3, true }, edge_type( 2 ) );
+    auto fwd = graph.add_path( "fwd" );
+    graph.extend_path( fwd, 1 );
+    graph.extend_path( fwd, 2 );
+    graph.extend_path( fwd, 3, true );
+    auto rev = graph.add_path( "rev" );
+    graph.extend_path( rev, 3 );
+    graph.extend_path( rev, 2, true );
+    graph.extend_path( rev, 1, true );
+
+    WHEN( "The path sequences are spelled" )
+    {
+      THEN( "Reverse steps should be complemented and overlaps should be skipped" )
+      {
+        std::vector< std::string > truth = { "ACGTAGGGT", "ACCCTACGT" };
+        REQUIRE( spell( graph ) == truth );
+        REQUIRE( spell( succinct_type( graph ) ) == truth );
+      }
+    }
+
+    WHEN( "The paths are written in FASTA format" )
+    {
+      THEN( "Sequences should be written in path order and wrapped if requested" )
+      {
+        succinct_type sgraph( graph );
+        REQUIRE( fasta( graph, 1 ) == ">fwd\nACGTAGGGT\n>rev\nACCCTACGT\n" );
+        REQUIRE( fasta( sgraph, 2 ) == ">fwd\nACGTAGGGT\n>rev\nACCCTACGT\n" );
+        REQUIRE( fasta( sgraph, 2, 3 ) == ">fwd\nACG\nTAG\nGGT\n>rev\nACC\nCTA\nCGT\n" );
+        REQUIRE( fasta( graph, 1, 4 ) == ">fwd\nACGT\nAGGG\nT\n>rev\nACCC\nTACG\nT\n" );
+      }
+    }
+  }
+
+  GIVEN( "A long path spanning many blocks of steps" )
+  {
+    graph_type graph;
+    std::string nucleotides = "ACGTN";
+    std::string truth;
+    std::mt19937 rng( 0 );
+    auto pid = graph.add_path( "long" );
+    for ( id_type id = 1; id <= 10000; ++id ) {
+      std::string seq( 1 + rng() % 30, 'A' );
+      for ( auto& c : seq ) c = nucleotides[ rng() % nucleotides.size() ];
+      graph.add_node( node_type( seq ), id );
+      if ( id > 1 ) graph.add_edge( graph.make_link( id - 1, id ) );
+      graph.extend_path( pid, id );
+      truth += seq;
+    }
+
+    WHEN( "It is written by multiple threads" )
+    {
+      THEN( "The output should be the same as the one written by a single thread" )
+      {
+        succinct_type sgraph( graph );
+        REQUIRE( spell( sgraph ) == std::vector< std::string >( { truth } ) );
+        REQUIRE( fasta( graph, 1 ) == ">long\n" + truth + "\n" );
+        REQUIRE( fasta( sgraph, 4 ) == ">long\n" + truth + "\n" );
+        REQUIRE( fasta( sgraph, 3, 60 ) == fasta( graph, 1, 60 ) );
+      }
+    }
+  }
+}
+
+SCENARIO( "Extracting subgraphs around seeds", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using succinct_type = typename graph_type::succinct_type;
+  using id_type = typename graph_type::id_type;
+  using rank_type = typename graph_type::rank_type;
+  using offset_type = typename graph_type::offset_type;
+  using node_type = typename graph_type::node_type;
+
+  GIVEN( "A chain graph with a path and a node attached by an inverted edge" )
+  {
+    graph_type graph;
+    graph.add_node( node_type( "ACGT" ), 1 );
+    graph.add_node( node_type( "GG" ), 2 );
+    graph.add_node( node_type( "TTTTT" ), 3 );
+    graph.add_node( node_type( "C" ), 4 );
+    graph.add_node( node_type( "AAA" ), 5 );
+    graph.add_node( node_type( "GC" ), 6 );
+    for ( id_type id = 1; id < 5; ++id ) graph.add_edge( graph.make_link( id, id + 1 ) );
+    graph.add_edge( { 5, true, 6, true } );
+    auto pid = graph.add_path( "p" );
+    for ( id_type id = 1; id <= 5; ++id ) graph.extend_path( pid, id );
+
+    auto nodes_of =
+        []( auto const& subgraph ) {
+          std::vector< id_type > ids;
+          subgraph.for_each_node(
+              [&ids]( rank_type, id_type id ) {
+                ids.push_back( id );
+                return true;
+              } );
+          return ids;
+        };
+
+    auto check =
+        [&nodes_of]( auto const& graph ) {
+          auto ibyc = [&graph]( id_type id ) { return graph.id_by_coordinate( id ); };
+          using ids_type = std::vector< id_type >;
+
+          auto subgraph = gum::util::extract_subgraph( graph, ids_type{ ibyc( 3 ) }, 1, gum::Steps{} );
+          REQUIRE( nodes_of( subgraph ) == ids_type( { 2, 3, 4 } ) );
+          REQUIRE( subgraph.get_edge_count() == 2 );
+          REQUIRE( subgraph.node_sequence( 3 ) == "TTTTT" );
+
+          subgraph = gum::util::extract_subgraph( graph, ids_type{ ibyc( 1 ) }, 2 );
+          REQUIRE( nodes_of( subgraph ) == ids_type( { 1, 2 } ) );
+          subgraph = gum::util::extract_subgraph( graph, ids_type{ ibyc( 1 ) }, 3, gum::BasePairs{} );
+          REQUIRE( nodes_of( subgraph ) == ids_type( { 1, 2, 3 } ) );
+
+          using position_type = std::pair< id_type, offset_type >;
+          std::vector< position_type > positions = { { ibyc( 3 ), 0 } };
+          subgraph = gum::util::extract_subgraph( graph, positions, 2 );
+          REQUIRE( nodes_of( subgraph ) == ids_type( { 2, 3 } ) );
+          subgraph = gum::util::extract_subgraph( graph, positions, 4 );
+          REQUIRE( nodes_of( subgraph ) == ids_type( { 1, 2, 3 } ) );
+          subgraph = gum::util::extract_subgraph( graph, positions, 5 );
+          REQUIRE( nodes_of( subgraph ) == ids_type( { 1, 2, 3, 4 } ) );
+
+          subgraph = gum::util::extract_subgraph( graph, ids_type{ ibyc( 6 ) }, 1, gum::Steps{} );
+          REQUIRE( nodes_of( subgraph ) == ids_type( { 5, 6 } ) );
+          REQUIRE( subgraph.has_edge( { 5, true, 6, true } ) );
+
+          subgraph = gum::util::extract_subgraph( graph, ids_type{ ibyc( 1 ), ibyc( 5 ) }, 1, gum::Steps{} );
+          REQUIRE( nodes_of( subgraph ) == ids_type( { 1, 2, 4, 5, 6 } ) );
+          REQUIRE( subgraph.get_edge_count() == 3 );
+          std::vector< std::string > names;
+          std::vector< std::string > seqs;
+          subgraph.for_each_path(
+              [&]( rank_type, id_type pid ) {
+                names.push_back( subgraph.path_name( pid ) );
+                std::string seq;
+                gum::util::path_sequence( subgraph, pid, std::back_inserter( seq ) );
+                seqs.push_back( seq );
+                return true;
+              } );
+          REQUIRE( names == std::vector< std::string >( { "p:0-6", "p:11-15" } ) );
+          REQUIRE( seqs == std::vector< std::string >( { "ACGTGG", "CAAA" } ) );
+
+          REQUIRE_THROWS( gum::util::extract_subgraph( graph, ids_type{ ibyc( 1 ), 0 }, 1 ) );
+          positions = { { ibyc( 1 ), graph.node_length( ibyc( 1 ) ) } };
+          REQUIRE_THROWS( gum::util::extract_subgraph( graph, positions, 1 ) );
+        };
+
+    WHEN( "Subgraphs are extracted around nodes or positions" )
+    {
+      THEN( "They should contain the nodes within the context keeping their IDs" )
+      {
+        check( graph );
+        check( succinct_type( graph ) );
+      }
+    }
+
+    WHEN( "A node is removed before extraction" )
+    {
+      graph.remove_node( 2 );
+      auto subgraph = gum::util::extract_subgraph( graph, std::vector< id_type >{ 6 }, 3, gum::Steps{} );
+
+      THEN( "The subgraph should be extracted around the remaining nodes" )
+      {
+        REQUIRE( !graph.is_compact() );
+        REQUIRE( nodes_of( subgraph ) == std::vector< id_type >( { 3, 4, 5, 6 } ) );
+        REQUIRE( subgraph.get_edge_count() == 3 );
+        REQUIRE( subgraph.get_path_count() == 1 );
+        REQUIRE( subgraph.path_name( subgraph.path_rank_to_id( 1 ) ) == "p:4-13" );
+      }
+    }
+  }
+}
+
+SCENARIO( "Filtering nodes and edges of a graph by a view", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using succinct_type = typename graph_type::succinct_type;
+  using id_type = typename graph_type::id_type;
+  using rank_type = typename graph_type::rank_type;
+  using linktype_type = typename graph_type::linktype_type;
+  using node_type = typename graph_type::node_type;
+  using edge_type = typename graph_type::edge_type;
+
+  GIVEN( "A graph with two chains joined by a bubble and a path through all nodes" )
+  {
+    // 1 -> 2 -> 3 -> 4 -> 5 -> 6 -> 7 -> 8, 2 -> 7, 5 -> 3
+    std::vector< std::string > seqs = { "AC", "G", "TT", "A", "CCA", "G", "T", "GA" };
+    std::vector< std::pair< id_type, id_type > > edges =
+        { { 1, 2 }, { 2, 3 }, { 3, 4 }, { 4, 5 }, { 5, 6 }, { 6, 7 }, { 7, 8 }, { 2, 7 }, { 5, 3 } };
+    auto hidden_node = []( id_type id ) { return id == 4; };
+    auto hidden_edge = []( id_type from, id_type to ) { return from == 6 && to == 7; };
+
+    graph_type graph;
+    graph_type truth;  // the filtered graph materialised
+    for ( id_type id = 1; id <= 8; ++id ) {
+      graph.add_node( node_type( seqs[ id - 1 ] ), id );
+      if ( !hidden_node( id ) ) truth.add_node( node_type( seqs[ id - 1 ] ), id );
+    }
+    for ( auto const& [ from, to ] : edges ) {
+      graph.add_edge( graph.make_link( from, to ), edge_type( 0 ) );
+      if ( !hidden_node( from ) && !hidden_node( to ) && !hidden_edge( from, to ) ) {
+        truth.add_edge( truth.make_link( from, to ) );
+      }
+    }
+    auto pid = graph.add_path( "all" );
+    auto tpid = truth.add_path( "all" );
+    for ( id_type id = 1; id <= 8; ++id ) {
+      graph.extend_path( pid, id );
+      if ( !hidden_node( id ) ) truth.extend_path( tpid, id );
+    }
+
+    auto check =
+        [&]( auto const& base ) {
+          using view_type = gum::FilteredGraphView< std::decay_t< decltype( base ) > >;
+          auto ibyc = [&base]( id_type id ) { return base.id_by_coordinate( id ); };
+          auto cid = [&base]( id_type id ) { return base.coordinate_id( id ); };
+
+          sdsl::bit_vector mask( base.get_node_count(), 1 );
+          mask[ base.id_to_rank( ibyc( 4 ) ) - 1 ] = 0;
+          view_type view( base, mask,
+                          [&cid, &hidden_edge]( id_type from, id_type to, linktype_type ) {
+                            return !hidden_edge( cid( from ), cid( to ) );
+                          } );
+
+          REQUIRE( view.get_node_count() == truth.get_node_count() );
+          REQUIRE( view.get_edge_count() == truth.get_edge_count() );
+          REQUIRE( !view.has_node( ibyc( 4 ) ) );
+          REQUIRE( !view.has_edge( ibyc( 6 ), ibyc( 7 ) ) );
+          REQUIRE( view.has_edge( ibyc( 2 ), ibyc( 7 ) ) );
+          REQUIRE( view.outdegree( ibyc( 3 ) ) == 0 );
+          REQUIRE( view.indegree( ibyc( 3 ) ) == 2 );
+
+          std::vector< id_type > ids;
+          view.for_each_node(
+              [&]( rank_type rank, id_type id ) {
+                REQUIRE( view.id_to_rank( id ) == rank );
+                REQUIRE( view.node_sequence( id ) == truth.node_sequence( cid( id ) ) );
+                ids.push_back( cid( id ) );
+                return true;
+              } );
+          REQUIRE( ids == std::vector< id_type >( { 1, 2, 3, 5, 6, 7, 8 } ) );
+
+          auto by_rank =
+              [&view, &cid]( auto const& values ) {
+                std::vector< std::pair< id_type, std::decay_t< decltype( values[ 0 ] ) > > > result;
+                for ( rank_type rank = 1; rank <= view.get_node_count(); ++rank ) {
+                  result.push_back( { cid( view.rank_to_id( rank ) ), values[ rank - 1 ] } );
+                }
+                return result;
+              };
+          auto truth_by_rank =
+              [&truth]( auto const& values ) {
+                std::vector< std::pair< id_type, std::decay_t< decltype( values[ 0 ] ) > > > result;
+                for ( rank_type rank = 1; rank <= truth.get_node_count(); ++rank ) {
+                  result.push_back( { truth.rank_to_id( rank ), values[ rank - 1 ] } );
+                }
+                return result;
+              };
+
+          REQUIRE( by_rank( gum::util::connected_components( view ).labels ) ==
+                   truth_by_rank( gum::util::connected_components( truth ).labels ) );
+          REQUIRE( by_rank( gum::util::strongly_connected_components( view ).labels ) ==
+                   truth_by_rank( gum::util::strongly_connected_components( truth ).labels ) );
+          REQUIRE( by_rank( gum::util::bfs_levels( view, std::vector< id_type >{ ibyc( 1 ) } ) ) ==
+                   truth_by_rank( gum::util::bfs_levels( truth, std::vector< id_type >{ 1 } ) ) );
+
+          std::string seq;
+          std::string truth_seq;
+          gum::util::path_sequence( view, pid, std::back_inserter( seq ) );
+          gum::util::path_sequence( truth, tpid, std::back_inserter( truth_seq ) );
+          REQUIRE( seq == truth_seq );
+
+          auto subgraph = gum::util::extract_subgraph( view, std::vector< id_type >{ ibyc( 2 ) }, 1, gum::Steps{} );
+          REQUIRE( subgraph.get_node_count() == 4 );
+          REQUIRE( subgraph.has_node( 1 ) );
+          REQUIRE( subgraph.has_node( 2 ) );
+          REQUIRE( subgraph.has_node( 3 ) );
+          REQUIRE( subgraph.has_node( 7 ) );
+        };
+
+    WHEN( "Nodes and edges are hidden by a view" )
+    {
+      THEN( "Algorithms on the view should match those on the filtered graph" )
+      {
+        check( graph );
+        succinct_type sgraph( graph );
+        check( sgraph );
+      }
+    }
+
+    WHEN( "A view is restricted to the nodes on a path" )
+    {
+      auto sub = truth.add_path( "sub" );
+      truth.extend_path( sub, 2 );
+      truth.extend_path( sub, 7, true );
+      gum::FilteredGraphView< graph_type > view( truth, gum::util::path_node_mask( truth, std::vector< id_type >{ sub } ) );
+
+      THEN( "Only those nodes and the edges between them should be in the view" )
+      {
+        REQUIRE( view.get_node_count() == 2 );
+        REQUIRE( view.get_edge_count() == 1 );
+        REQUIRE( view.rank_to_id( 1 ) == 2 );
+        REQUIRE( view.rank_to_id( 2 ) == 7 );
+      }
+    }
+
+    WHEN( "A view is restricted to the nodes on a path of a graph with a removed node" )
+    {
+      graph.remove_node( 4 );
+      gum::FilteredGraphView< graph_type > view( graph, gum::util::path_node_mask( graph, std::vector< id_type >{ pid } ) );
+      gum::FilteredGraphView< graph_type > all( graph, sdsl::bit_vector( graph.get_max_rank(), 1 ) );
+
+      THEN( "The removed node should be skipped" )
+      {
+        REQUIRE( !graph.is_compact() );
+        REQUIRE( view.get_node_count() == 7 );
+        REQUIRE( view.get_edge_count() == 7 );
+        REQUIRE( all.get_node_count() == 7 );
+        std::vector< id_type > ids;
+        view.for_each_node(
+            [&ids]( rank_type, id_type id ) {
+              ids.push_back( id );
+              return true;
+            } );
+        REQUIRE( ids == std::vector< id_type >( { 1, 2, 3, 5, 6, 7, 8 } ) );
+        auto levels = gum::util::bfs_levels( view, std::vector< id_type >{ 1 } );
+        REQUIRE( levels.size() == 7 );
+        REQUIRE( levels[ view.id_to_rank( 8 ) - 1 ] == 3 );
+      }
+    }
+  }
+}
+
+SCENARIO( "Runtime selection of integer widths", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using succinct_type = typename graph_type::succinct_type;
+  using id_type = typename graph_type::id_type;
+  using rank_type = typename graph_type::rank_type;
+
+  GIVEN( "A small Dynamic graph" )
+  {
+    std::string filepath = test_data_dir + "/tiny.gfa";
+    graph_type graph;
+    gum::util::load( graph, filepath, true );
+    succinct_type sc_graph( graph );
+
+    auto equality_test =
+        [&sc_graph]( auto const& graph ) {
+          using graph_type = std::decay_t< decltype( graph ) >;
+          using g_id_type = typename graph_type::id_type;
+          using g_rank_type = typename graph_type::rank_type;
+          using g_linktype_type = typename graph_type::linktype_type;
+
+          REQUIRE( graph.get_node_count() == sc_graph.get_node_count() );
+          REQUIRE( graph.get_edge_count() == sc_graph.get_edge_count() );
+          REQUIRE( graph.get_path_count() == sc_graph.get_path_count() );
+          graph.for_each_node(
+              [&]( g_rank_type rank, g_id_type id ) {
+                id_type sc_id = sc_graph.rank_to_id( rank );
+                REQUIRE( graph.coordinate_id( id ) == sc_graph.coordinate_id( sc_id ) );
+                REQUIRE( graph.node_sequence( id ) == sc_graph.node_sequence( sc_id ) );
+                REQUIRE( graph.outdegree( id ) == sc_graph.outdegree( sc_id ) );
+                REQUIRE( graph.indegree( id ) == sc_graph.indegree( sc_id ) );
+                graph.for_each_edges_out(
+                    id,
+                    [&]( g_id_type to, g_linktype_type type ) {
+                      id_type sc_to = sc_graph.rank_to_id( graph.id_to_rank( to ) );
+                      REQUIRE( sc_graph.has_edge( sc_id, sc_to, type ) );
+                      REQUIRE( graph.edge_overlap( id, to, type ) ==
+                               sc_graph.edge_overlap( sc_id, sc_to, type ) );
+                      return true;
+                    } );
+                return true;
+              } );
+          graph.for_each_path(
+              [&]( g_rank_type rank, g_id_type pid ) {
+                REQUIRE( graph.path_name( pid ) == sc_graph.path_name( sc_graph.path_rank_to_id( rank ) ) );
+                REQUIRE( graph.path_length( pid ) == sc_graph.path_length( sc_graph.path_rank_to_id( rank ) ) );
+                return true;
+              } );
+        };
+
+    WHEN( "The required integer width is computed" )
+    {
+      THEN( "It should be 32" )
+      {
+        REQUIRE( gum::util::succinct_width( graph ) == 32 );
+      }
+    }
+
+    WHEN( "It is copied into a Dynamic graph with narrower integer widths" )
+    {
+      gum::SeqGraph< gum::Dynamic, void, gum::NodeProperty, gum::EdgeProperty, gum::GraphProperty, 32, 32 > n_graph;
+      gum::util::copy_graph( graph, n_graph );
+      THEN( "Node IDs should be preserved" )
+      {
+        graph.for_each_node(
+            [&n_graph]( rank_type rank, id_type id ) {
+              REQUIRE( n_graph.rank_to_id( rank ) == id );
+              return true;
+            } );
+        equality_test( n_graph );
+      }
+    }
+
+    WHEN( "A Succinct graph with the narrowest integer widths is constructed" )
+    {
+      auto variant = gum::util::make_succinct_variant( graph );
+      THEN( "The 32-bit alternative should be selected" )
+      {
+        REQUIRE( variant.index() == 0 );
+        REQUIRE( sizeof( typename std::variant_alternative_t< 0, decltype( variant ) >::id_type ) == 4 );
+      }
+
+      THEN( "It should be equivalent to the 64-bit Succinct graph" )
+      {
+        std::visit( equality_test, variant );
+      }
+    }
+  }
+}
+
+SCENARIO( "Modifying a Succinct SeqGraph through an overlay", "[seqgraph]" )
+{
+  GIVEN( "An overlay on a Succinct SeqGraph" )
+  {
+    using graph_type = gum::SeqGraph< gum::Dynamic >;
+    using succinct_type = typename graph_type::succinct_type;
+    using overlay_type = gum::SeqGraphOverlay< succinct_type >;
+    using id_type = typename overlay_type::id_type;
+    using rank_type = typename overlay_type::rank_type;
+    using linktype_type = typename overlay_type::linktype_type;
+    using node_type = typename overlay_type::node_type;
+    using edge_type = typename overlay_type::edge_type;
+
+    std::string filepath = test_data_dir + "/tiny.gfa";
+    graph_type graph;
+    gum::util::load( graph, filepath, true );
+    succinct_type sc_graph( graph );
+    overlay_type overlay( sc_graph );
+
+    auto ibyc = [&sc_graph]( id_type cid ) { return sc_graph.id_by_coordinate( cid ); };
+    auto out_ids =
+        []( auto const& graph, id_type id ) {
+          std::vector< id_type > ids;
+          graph.for_each_edges_out(
+              id,
+              [&ids]( id_type to, linktype_type ) {
+                ids.push_back( to );
+                return true;
+              } );
+          std::sort( ids.begin(), ids.end() );
+          return ids;
+        };
+
+    THEN( "It should be equivalent to the base graph when unmodified" )
+    {
+      REQUIRE( overlay.empty() );
+      REQUIRE( overlay.get_node_count() == sc_graph.get_node_count() );
+      REQUIRE( overlay.get_edge_count() == sc_graph.get_edge_count() );
+      REQUIRE( overlay.get_path_count() == sc_graph.get_path_count() );
+      overlay.for_each_node(
+          [&]( rank_type rank, id_type id ) {
+            REQUIRE( sc_graph.rank_to_id( rank ) == id );
+            REQUIRE( overlay.node_sequence( id ) == sc_graph.node_sequence( id ) );
+            REQUIRE( overlay.indegree( id ) == sc_graph.indegree( id ) );
+            REQUIRE( out_ids( overlay, id ) == out_ids( sc_graph, id ) );
+            return true;
+          } );
+    }
+
+    WHEN( "Nodes, edges and paths are added and removed" )
+    {
+      id_type new_id = overlay.add_node( node_type( "ACGT", "new" ) );
+      overlay.add_edge( overlay.end_side( ibyc( 15 ) ), overlay.start_side( new_id ), edge_type( 2 ) );
+      overlay.remove_edge( overlay.end_side( ibyc( 1 ) ), overlay.start_side( ibyc( 2 ) ) );
+      id_type pid = overlay.add_path( "z" );
+      overlay.extend_path( pid, ibyc( 1 ) );
+      overlay.extend_path( pid, ibyc( 4 ) );
+      overlay.extend_path( pid, new_id, true );
+      overlay.remove_node( ibyc( 4 ) );
+
+      THEN( "Queries should reflect the modifications" )
+      {
+        REQUIRE( !overlay.empty() );
+        REQUIRE( overlay.get_node_count() == sc_graph.get_node_count() );
+        REQUIRE( overlay.get_edge_count() == sc_graph.get_edge_count() - 3 );
+        REQUIRE( overlay.get_path_count() == sc_graph.get_path_count() + 1 );
+        REQUIRE( overlay.has_node( new_id ) );
+        REQUIRE( !overlay.has_node( ibyc( 4 ) ) );
+        REQUIRE( overlay.node_sequence( new_id ) == "ACGT" );
+        REQUIRE( overlay.node_length( new_id ) == 4 );
+        REQUIRE( overlay.has_edge( ibyc( 15 ), new_id ) );
+        REQUIRE( overlay.edge_overlap( ibyc( 15 ), new_id ) == 2 );
+        REQUIRE( overlay.edge_overlap( ibyc( 1 ), ibyc( 3 ) ) == 0 );
+        REQUIRE( !overlay.has_edge( ibyc( 1 ), ibyc( 2 ) ) );
+        REQUIRE( !overlay.has_edge( ibyc( 2 ), ibyc( 4 ) ) );
+        REQUIRE( overlay.has_edge( ibyc( 2 ), ibyc( 5 ) ) );
+        REQUIRE( out_ids( overlay, ibyc( 1 ) ) == std::vector< id_type >{ ibyc( 3 ) } );
+        REQUIRE( out_ids( overlay, ibyc( 15 ) ) == std::vector< id_type >{ new_id } );
+        REQUIRE( overlay.indegree( new_id ) == 1 );
+        REQUIRE( overlay.indegree( ibyc( 2 ) ) == 0 );
+        REQUIRE( overlay.indegree( ibyc( 6 ) ) == 1 );
+        REQUIRE( overlay.adjacents_in( overlay.start_side( new_id ) ).size() == 1 );
+        REQUIRE( overlay.path_name( pid ) == "z" );
+        REQUIRE( overlay.path_length( pid ) == 2 );
+        rank_type count = 0;
+        overlay.for_each_node( [&count]( rank_type, id_type ) { ++count; return true; } );
+        REQUIRE( count == overlay.get_node_count() );
+      }
+
+      AND_WHEN( "It is compacted" )
+      {
+        auto c_graph = overlay.compact();
+        auto cbyc = [&c_graph]( id_type cid ) { return c_graph.id_by_coordinate( cid ); };
+
+        THEN( "The resulting graph should contain the modifications" )
+        {
+          REQUIRE( c_graph.get_node_count() == overlay.get_node_count() );
+          REQUIRE( c_graph.get_edge_count() == overlay.get_edge_count() );
+          REQUIRE( c_graph.get_path_count() == overlay.get_path_count() );
+          REQUIRE( c_graph.node_sequence( cbyc( 1 ) ) == "CAAATAAG" );
+          REQUIRE( c_graph.node_sequence( cbyc( 16 ) ) == "ACGT" );
+          REQUIRE( c_graph.has_edge( cbyc( 15 ), cbyc( 16 ) ) );
+          REQUIRE( c_graph.edge_overlap( cbyc( 15 ), cbyc( 16 ) ) == 2 );
+          REQUIRE( !c_graph.has_edge( cbyc( 1 ), cbyc( 2 ) ) );
+          REQUIRE( c_graph.has_edge( cbyc( 1 ), cbyc( 3 ) ) );
+          REQUIRE( c_graph.path_name( c_graph.path_rank_to_id( 2 ) ) == "z" );
+          REQUIRE( c_graph.path_length( c_graph.path_rank_to_id( 1 ) ) == 10 );
+          REQUIRE( c_graph.path_length( c_graph.path_rank_to_id( 2 ) ) == 2 );
+          overlay_type c_overlay( c_graph );
+          REQUIRE( c_overlay.get_node_count() == overlay.get_node_count() );
+        }
+      }
+    }
+  }
+}
+
+SCENARIO( "Constructing a Dynamic SeqGraph from a Succinct one", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using succinct_type = typename graph_type::succinct_type;
+  using id_type = typename graph_type::id_type;
+  using rank_type = typename graph_type::rank_type;
+  using linktype_type = typename graph_type::linktype_type;
+  using adjs_type = std::vector< std::pair< id_type, linktype_type > >;
+
+  GIVEN( "A Succinct graph constructed from a Dynamic one" )
+  {
+    std::string filepath = test_data_dir + "/tiny.gfa";
+    graph_type graph;
+    gum::util::load( graph, filepath, true );
+    succinct_type sc_graph( graph );
+
+    auto edges_out =
+        []( auto const& graph, id_type id ) {
+          adjs_type adjs;
+          graph.for_each_edges_out(
+              id,
+              [&adjs]( id_type to, linktype_type type ) {
+                adjs.emplace_back( to, type );
+                return true;
+              } );
+          return adjs;
+        };
+    auto edges_in =
+        []( auto const& graph, id_type id ) {
+          adjs_type adjs;
+          graph.for_each_edges_in(
+              id,
+              [&adjs]( id_type from, linktype_type type ) {
+                adjs.emplace_back( from, type );
+                return true;
+              } );
+          return adjs;
+        };
+
+    auto equality_test =
+        [&]( graph_type const& d_graph, bool ordered_in ) {
+          REQUIRE( d_graph.get_node_count() == graph.get_node_count() );
+          REQUIRE( d_graph.get_edge_count() == graph.get_edge_count() );
+          REQUIRE( d_graph.get_path_count() == graph.get_path_count() );
+          graph.for_each_node(
+              [&]( rank_type rank, id_type id ) {
+                REQUIRE( d_graph.rank_to_id( rank ) == id );
+                REQUIRE( d_graph.id_by_coordinate( id ) == id );
+                REQUIRE( d_graph.node_sequence( id ) == graph.node_sequence( id ) );
+                REQUIRE( d_graph.get_node_prop( rank ).name == std::as_const( graph ).get_node_prop( rank ).name );
+                REQUIRE( edges_out( d_graph, id ) == edges_out( graph, id ) );
+                auto d_in = edges_in( d_graph, id );
+                auto in = edges_in( graph, id );
+                if ( !ordered_in ) {
+                  std::sort( d_in.begin(), d_in.end() );
+                  std::sort( in.begin(), in.end() );
+                }
+                REQUIRE( d_in == in );
+                graph.for_each_edges_out(
+                    id,
+                    [&]( id_type to, linktype_type type ) {
+                      REQUIRE( d_graph.has_edge( d_graph.make_link( id, to, type ) ) );
+                      REQUIRE( d_graph.edge_overlap( id, to, type ) ==
+                               graph.edge_overlap( id, to, type ) );
+                      return true;
+                    } );
+                return true;
+              } );
+          sc_graph.for_each_path(
+              [&]( rank_type rank, id_type pid ) {
+                REQUIRE( d_graph.path_rank_to_id( rank ) == pid );
+                REQUIRE( d_graph.path_name( pid ) == sc_graph.path_name( pid ) );
+                auto const& path = graph.path( graph.path_rank_to_id( rank ) );
+                REQUIRE( d_graph.path( pid ).get_nodes() == path.get_nodes() );
+                return true;
+              } );
+        };
+
+    WHEN( "A Dynamic graph is constructed from it" )
+    {
+      graph_type d_graph( sc_graph );
+
+      THEN( "It should be identical to the original Dynamic graph" )
+      {
+        equality_test( d_graph, true );
+      }
+
+      AND_WHEN( "It is modified" )
+      {
+        id_type nid = d_graph.add_node( { "ACGT", "new" } );
+        d_graph.add_edge( d_graph.make_link( graph.rank_to_id( 1 ), nid ) );
+        id_type pid = d_graph.add_path( "new" );
+
+        THEN( "New IDs should not collide with the existing ones" )
+        {
+          REQUIRE( !graph.has_node( nid ) );
+          REQUIRE( d_graph.get_node_count() == graph.get_node_count() + 1 );
+          REQUIRE( d_graph.get_edge_count() == graph.get_edge_count() + 1 );
+          REQUIRE( !sc_graph.has_path( pid ) );
+          REQUIRE( d_graph.get_path_count() == graph.get_path_count() + 1 );
+        }
+      }
+    }
+
+    WHEN( "A Dynamic graph is assigned by an out-only Succinct graph" )
+    {
+      graph_type d_graph;
+      d_graph = succinct_type( graph, true );
+
+      THEN( "It should be equivalent to the original Dynamic graph" )
+      {
+        equality_test( d_graph, false );
+      }
+    }
+  }
+}
+
+SCENARIO( "Removing nodes, edges and path steps from a Dynamic SeqGraph", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using succinct_type = typename graph_type::succinct_type;
+  using id_type = typename graph_type::id_type;
+  using rank_type = typename graph_type::rank_type;
+  using node_type = typename graph_type::node_type;
+  using edge_type = typename graph_type::edge_type;
+
+  GIVEN( "A small Dynamic graph with paths" )
+  {
+    graph_type graph;
+    std::vector< std::string > seqs = { "A", "CC", "GGG", "TTTT", "ACGTA" };
+    for ( auto const& seq : seqs ) graph.add_node( node_type( seq, "n" + seq ) );
+    graph.add_edge( graph.make_link( 1, 2 ), edge_type( 1 ) );
+    graph.add_edge( graph.make_link( 2, 3 ), edge_type( 2 ) );
+    graph.add_edge( graph.make_link( 1, 3 ), edge_type( 3 ) );
+    graph.add_edge( graph.make_link( 3, 4 ) );
+    graph.add_edge( graph.make_link( 4, 5 ) );
+    graph.add_edge( graph.make_link( 2, 5 ), edge_type( 4 ) );
+    std::vector< id_type > p_nodes = { 1, 2, 3, 4, 5 };
+    std::vector< id_type > q_nodes = { 1, 3, 5 };
+    id_type p = graph.add_path( p_nodes.begin(), p_nodes.end(), "p" );
+    id_type q = graph.add_path( q_nodes.begin(), q_nodes.end(), "q" );
+
+    auto path_nodes =
+        [&graph]( id_type pid ) {
+          std::vector< id_type > ids;
+          for ( auto const& value : graph.path( pid ) ) {
+            ids.push_back( graph.path( pid ).id_of( value ) );
+          }
+          return ids;
+        };
+
+    WHEN( "A node, an edge and a path step are removed" )
+    {
+      graph.remove_node( 3 );
+      graph.remove_edge( 4, 5 );
+      graph.remove_path_step( p, 0 );
+
+      THEN( "They should not be present in the graph" )
+      {
+        REQUIRE( !graph.has_node( 3 ) );
+        REQUIRE( !graph.is_compact() );
+        REQUIRE( graph.get_node_count() == 4 );
+        REQUIRE( graph.get_edge_count() == 2 );
+        REQUIRE( !graph.has_edge( graph.make_link( 2, 3 ) ) );
+        REQUIRE( !graph.has_edge( graph.make_link( 4, 5 ) ) );
+        REQUIRE( graph.has_edge( graph.make_link( 2, 5 ) ) );
+        REQUIRE( graph.outdegree( id_type( 1 ) ) == 1 );
+        REQUIRE( graph.indegree( id_type( 4 ) ) == 0 );
+        REQUIRE( graph.indegree( id_type( 5 ) ) == 1 );
+        REQUIRE( graph.path_length( p ) == 4 );
+      }
+
+      THEN( "Ranks of the remaining nodes should be unchanged" )
+      {
+        std::vector< rank_type > ranks;
+        graph.for_each_node(
+            [&]( rank_type rank, id_type id ) {
+              REQUIRE( graph.id_to_rank( id ) == rank );
+              ranks.push_back( rank );
+              return true;
+            } );
+        REQUIRE( ranks == std::vector< rank_type >( { 1, 2, 4, 5 } ) );
+        REQUIRE( graph.rank_to_id( 3 ) == 0 );
+        REQUIRE( graph.successor_id( 2 ) == 4 );
+        REQUIRE( graph.get_max_rank() == 5 );
+      }
+
+      THEN( "Traversals should visit each remaining node once" )
+      {
+        std::vector< id_type > dfs_ids;
+        gum::util::dfs_traverse( graph, [&]( rank_type, id_type id ) { dfs_ids.push_back( id ); } );
+        std::sort( dfs_ids.begin(), dfs_ids.end() );
+        REQUIRE( dfs_ids == std::vector< id_type >( { 1, 2, 4, 5 } ) );
+        std::vector< id_type > bfs_ids;
+        gum::util::bfs_traverse( graph, [&]( rank_type, id_type id ) { bfs_ids.push_back( id ); } );
+        std::sort( bfs_ids.begin(), bfs_ids.end() );
+        REQUIRE( bfs_ids == std::vector< id_type >( { 1, 2, 4, 5 } ) );
+      }
+
+      THEN( "It cannot be converted to a Succinct graph before compaction" )
+      {
+        REQUIRE_THROWS( succinct_type( graph ) );
+      }
+
+      AND_WHEN( "It is compacted" )
+      {
+        graph.compact();
+
+        THEN( "Tombstones should be dropped and ranks renumbered" )
+        {
+          REQUIRE( graph.is_compact() );
+          REQUIRE( graph.get_node_count() == 4 );
+          REQUIRE( graph.get_max_rank() == 4 );
+          REQUIRE( std::as_const( graph ).get_node_prop().size() == 4 );
+          REQUIRE( std::as_const( graph ).get_node_prop().get_sequences_len_sum() == 12 );
+          std::vector< id_type > ids;
+          graph.for_each_node(
+              [&]( rank_type rank, id_type id ) {
+                REQUIRE( graph.id_to_rank( id ) == rank );
+                REQUIRE( graph.node_sequence( id ) == seqs[ id - 1 ] );
+                ids.push_back( id );
+                return true;
+              } );
+          REQUIRE( ids == std::vector< id_type >( { 1, 2, 4, 5 } ) );
+          REQUIRE( graph.edge_overlap( 2, 5 ) == 4 );
+          REQUIRE( path_nodes( p ) == std::vector< id_type >( { 2, 4, 5 } ) );
+          REQUIRE( path_nodes( q ) == std::vector< id_type >( { 1, 5 } ) );
+        }
+
+        THEN( "It can be converted to a Succinct graph" )
+        {
+          succinct_type sc_graph( graph );
+          REQUIRE( sc_graph.get_node_count() == 4 );
+          REQUIRE( sc_graph.get_edge_count() == 2 );
+          REQUIRE( sc_graph.path_length( sc_graph.path_rank_to_id( 1 ) ) == 3 );
+        }
+
+        THEN( "New nodes can be added" )
+        {
+          id_type id = graph.add_node( node_type( "T" ) );
+          REQUIRE( !graph.has_node( 3 ) );
+          REQUIRE( graph.id_to_rank( id ) == 5 );
+          REQUIRE( graph.get_node_count() == 5 );
+        }
+      }
+    }
+
+    WHEN( "The first and the last steps of a path are removed" )
+    {
+      graph.remove_path_step( p, 4 );
+      graph.remove_path_step( p, 0 );
+
+      THEN( "The path should only contain the remaining steps" )
+      {
+        auto const& path = graph.path( p );
+        REQUIRE( graph.is_compact() );
+        REQUIRE( graph.path_length( p ) == 3 );
+        REQUIRE( path.end() - path.begin() == 3 );
+        REQUIRE( path.id_of( path.front() ) == 2 );
+        REQUIRE( path.id_of( path.back() ) == 4 );
+        REQUIRE( path_nodes( p ) == std::vector< id_type >( { 2, 3, 4 } ) );
+        REQUIRE( path_nodes( q ) == std::vector< id_type >( { 1, 3, 5 } ) );
+      }
+
+      THEN( "It can be converted to a Succinct graph without compaction" )
+      {
+        succinct_type sc_graph( graph );
+        auto sc_path = sc_graph.path( sc_graph.path_rank_to_id( 1 ) );
+        std::vector< id_type > ids;
+        for ( auto const& value : sc_path ) {
+          ids.push_back( sc_graph.coordinate_id( sc_path.id_of( value ) ) );
+        }
+        REQUIRE( ids == std::vector< id_type >( { 2, 3, 4 } ) );
+      }
+    }
+  }
+}
+
+SCENARIO( "Adding nodes and edges in bulk to a Dynamic SeqGraph", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using id_type = typename graph_type::id_type;
+  using rank_type = typename graph_type::rank_type;
+  using node_type = typename graph_type::node_type;
+  using link_type = typename graph_type::link_type;
+  using edge_type = typename graph_type::edge_type;
+
+  GIVEN( "A Dynamic graph with a few nodes and edges" )
+  {
+    graph_type graph;
+    graph.add_node( node_type( "A", "a" ), 10 );
+    graph.add_node( node_type( "CC", "c" ), 3 );
+    graph.add_edge( graph.make_link( 10, 3 ), edge_type( 1 ) );
+
+    WHEN( "Nodes are added in bulk with both external and internal IDs" )
+    {
+      std::vector< std::pair< node_type, id_type > > nodes = {
+        { node_type( "GGG", "g" ), 0 },
+        { node_type( "TTTT", "t" ), 7 },
+        { node_type( "ACGTA", "x" ), 0 } };
+      std::vector< id_type > ids;
+      graph.add_nodes_bulk( std::make_move_iterator( nodes.begin() ),
+                            std::make_move_iterator( nodes.end() ),
+                            [&ids]( id_type id ) { ids.push_back( id ); } );
+
+      THEN( "Internal IDs should avoid the existing ones and ranks should follow the range" )
+      {
+        REQUIRE( ids == std::vector< id_type >( { 4, 7, 8 } ) );
+        REQUIRE( graph.get_node_count() == 5 );
+        std::vector< std::string > seqs = { "GGG", "TTTT", "ACGTA" };
+        for ( std::size_t i = 0; i < ids.size(); ++i ) {
+          REQUIRE( graph.id_to_rank( ids[ i ] ) == static_cast< rank_type >( i + 3 ) );
+          REQUIRE( graph.node_sequence( ids[ i ] ) == seqs[ i ] );
+        }
+        REQUIRE( graph.add_node() == 9 );
+        REQUIRE( graph.add_node( 2 ) == 2 );
+        REQUIRE( graph.add_node() == 11 );
+      }
+    }
+
+    WHEN( "A node with an existing ID is added in bulk" )
+    {
+      std::vector< std::pair< node_type, id_type > > nodes = { { node_type( "T" ), 3 } };
+
+      THEN( "It should throw" )
+      {
+        REQUIRE_THROWS( graph.add_nodes_bulk( nodes.begin(), nodes.end() ) );
+      }
+    }
+
+    WHEN( "Edges including duplicates are added in bulk" )
+    {
+      graph.add_node( node_type( "GGG" ), 4 );
+      std::vector< std::pair< link_type, edge_type > > edges = {
+        { graph.make_link( 3, 4 ), edge_type( 2 ) },
+        { graph.make_link( 10, 3 ), edge_type( 5 ) },
+        { graph.make_link( 10, 4 ), edge_type( 3 ) },
+        { graph.make_link( 3, 4 ), edge_type( 6 ) } };
+      graph.add_edges_bulk( edges.begin(), edges.end() );
+
+      THEN( "Only the first occurrence of new edges should be added in order" )
+      {
+        REQUIRE( graph.get_edge_count() == 3 );
+        REQUIRE( graph.edge_overlap( 10, 3 ) == 1 );
+        REQUIRE( graph.edge_overlap( 3, 4 ) == 2 );
+        REQUIRE( graph.edge_overlap( 10, 4 ) == 3 );
+        REQUIRE( graph.outdegree( id_type( 10 ) ) == 2 );
+        REQUIRE( graph.indegree( id_type( 4 ) ) == 2 );
+        std::vector< id_type > adjs;
+        graph.for_each_edges_out(
+            10,
+            [&adjs]( id_type to, auto ) {
+              adjs.push_back( to );
+              return true;
+            } );
+        REQUIRE( adjs == std::vector< id_type >( { 3, 4 } ) );
+      }
+    }
+  }
+}
+
+SCENARIO( "Node sequences of a Dynamic SeqGraph in the character arena", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using node_prop_type = typename graph_type::node_prop_type;
+  using node_type = typename graph_type::node_type;
+
+  GIVEN( "A Dynamic graph with a few nodes" )
+  {
+    graph_type graph;
+    graph.add_node( node_type( "ACG", "first" ), 1 );
+    graph.add_node( node_type( "T", "second" ), 2 );
+    graph.add_node( node_type( "", "" ), 3 );
+    graph.add_node( node_type( "GGCCA", "fourth" ), 4 );
+    node_prop_type const& node_prop = std::as_const( graph ).get_node_prop();
+
+    THEN( "Sequences and names should be viewed in place" )
+    {
+      REQUIRE( graph.node_sequence( 1 ) == "ACG" );
+      REQUIRE( graph.node_sequence( 3 ).empty() );
+      REQUIRE( node_prop[ 1 ].name == "second" );
+      REQUIRE( node_prop.get_sequences_len_sum() == 9 );
+      REQUIRE( node_prop.get_names_len_sum() == 17 );
+      auto sequences = node_prop.sequences();
+      std::vector< std::string > seqs( sequences.begin(), sequences.end() );
+      REQUIRE( seqs == std::vector< std::string >( { "ACG", "T", "", "GGCCA" } ) );
+      node_type node = node_prop.back();
+      REQUIRE( node.sequence == "GGCCA" );
+    }
+
+    WHEN( "A node is updated" )
+    {
+      std::string_view view = graph.node_sequence( 2 );
+      graph.update_node( 1, node_type( "CCCCCCCC", "updated" ) );
+
+      THEN( "The new sequence should be written without moving the others" )
+      {
+        REQUIRE( graph.node_sequence( 1 ) == "CCCCCCCC" );
+        REQUIRE( graph.get_node_prop( 1 ).name == "updated" );
+        REQUIRE( view.data() == graph.node_sequence( 2 ).data() );
+        REQUIRE( node_prop.get_sequences_len_sum() == 14 );
+        REQUIRE( node_prop.get_names_len_sum() == 19 );
+      }
+
+      AND_WHEN( "The graph is shrunk to fit" )
+      {
+        graph.shrink_to_fit();
+
+        THEN( "The node sequences should be preserved" )
+        {
+          REQUIRE( graph.node_sequence( 1 ) == "CCCCCCCC" );
+          REQUIRE( graph.node_sequence( 2 ) == "T" );
+          REQUIRE( graph.node_sequence( 4 ) == "GGCCA" );
+          REQUIRE( graph.get_node_prop( 4 ).name == "fourth" );
+        }
+      }
+    }
+
+    WHEN( "Nodes are sorted and some are removed" )
+    {
+      graph.sort_nodes( std::vector< std::size_t >( { 3, 2, 1, 0 } ) );
+      graph.remove_node( 2 );
+      graph.compact();
+
+      THEN( "Node sequences should follow the new ranks" )
+      {
+        auto sequences = node_prop.sequences();
+        auto names_set = node_prop.names();
+        std::vector< std::string > seqs( sequences.begin(), sequences.end() );
+        std::vector< std::string > names( names_set.begin(), names_set.end() );
+        REQUIRE( seqs.size() == graph.get_node_count() );
+        for ( std::size_t i = 0; i < seqs.size(); ++i ) {
+          REQUIRE( seqs[ i ] == graph.node_sequence( graph.rank_to_id( i + 1 ) ) );
+        }
+        REQUIRE( seqs == std::vector< std::string >( { "GGCCA", "", "ACG" } ) );
+        REQUIRE( names == std::vector< std::string >( { "fourth", "", "first" } ) );
+        REQUIRE( node_prop.get_sequences_len_sum() == 8 );
+        REQUIRE( node_prop.get_names_len_sum() == 11 );
+      }
+    }
+  }
+}
+
+SCENARIO( "Storing only non-default edge properties", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using succinct_type = typename graph_type::succinct_type;
+  using id_type = typename graph_type::id_type;
+  using node_type = typename graph_type::node_type;
+  using edge_type = typename graph_type::edge_type;
+
+  GIVEN( "A Dynamic graph whose edges have no overlaps" )
+  {
+    graph_type graph;
+    graph.add_node( node_type( "ACG" ), 1 );
+    graph.add_node( node_type( "T" ), 2 );
+    graph.add_node( node_type( "GG" ), 3 );
+    graph.add_edge( graph.make_link( 1, 2 ) );
+    graph.add_edge( graph.make_link( 1, 3 ), edge_type( 0 ) );
+    graph.add_edge( graph.make_link( 2, 3 ) );
+
+    THEN( "No edge property should be stored" )
+    {
+      REQUIRE( !graph.has_edge_overlaps() );
+      REQUIRE( std::as_const( graph ).get_edge_prop().size() == 0 );
+      REQUIRE( graph.has_edge( graph.make_link( 1, 3 ) ) );
+      REQUIRE( !graph.has_edge( graph.make_link( 3, 1 ) ) );
+      REQUIRE( graph.edge_overlap( 1, 3 ) == 0 );
+    }
+
+    WHEN( "It is converted to a Succinct graph" )
+    {
+      succinct_type sgraph( graph );
+      succinct_type padded;
+
+      THEN( "The edge entries should not store overlaps" )
+      {
+        REQUIRE( !sgraph.has_edge_overlaps() );
+        REQUIRE( sgraph.get_edge_padding() == 0 );
+        REQUIRE( padded.get_edge_padding() == succinct_type::EDGE_PADDING );
+        REQUIRE( sgraph.get_edge_count() == 3 );
+        REQUIRE( sgraph.edge_overlap( sgraph.id_by_coordinate( 1 ), sgraph.id_by_coordinate( 3 ) ) == 0 );
+        sgraph.for_each_edges_out(
+            sgraph.id_by_coordinate( 1 ),
+            [&sgraph]( id_type, auto, auto handle ) {
+              REQUIRE( sgraph.edge_overlap( handle ) == 0 );
+              return true;
+            } );
+      }
+
+      AND_WHEN( "It is converted back to a Dynamic graph" )
+      {
+        graph_type dgraph( sgraph );
+
+        THEN( "No edge property should be stored either" )
+        {
+          REQUIRE( !dgraph.has_edge_overlaps() );
+          REQUIRE( dgraph.get_edge_count() == 3 );
+        }
+      }
+    }
+
+    WHEN( "An edge with an overlap is added" )
+    {
+      graph.add_node( node_type( "CA" ), 4 );
+      graph.add_edge( graph.make_link( 3, 4 ), edge_type( 1 ) );
+      succinct_type sgraph( graph );
+      graph_type dgraph( sgraph );
+
+      THEN( "Only that edge property should be stored" )
+      {
+        REQUIRE( graph.has_edge_overlaps() );
+        REQUIRE( std::as_const( graph ).get_edge_prop().size() == 1 );
+        REQUIRE( graph.edge_overlap( 3, 4 ) == 1 );
+        REQUIRE( graph.edge_overlap( 2, 3 ) == 0 );
+        REQUIRE( sgraph.has_edge_overlaps() );
+        REQUIRE( sgraph.edge_overlap( sgraph.id_by_coordinate( 3 ), sgraph.id_by_coordinate( 4 ) ) == 1 );
+        REQUIRE( sgraph.edge_overlap( sgraph.id_by_coordinate( 2 ), sgraph.id_by_coordinate( 3 ) ) == 0 );
+        REQUIRE( std::as_const( dgraph ).get_edge_prop().size() == 1 );
+        REQUIRE( dgraph.edge_overlap( 3, 4 ) == 1 );
+      }
+
+      AND_WHEN( "That edge is removed" )
+      {
+        graph.remove_edge( graph.make_link( 3, 4 ) );
+
+        THEN( "No edge property should be stored" )
+        {
+          REQUIRE( !graph.has_edge_overlaps() );
+        }
+      }
+    }
+  }
+}
+
+SCENARIO( "Mapping node IDs to ranks", "[seqgraph]" )
+{
+  using rank_map_type = gum::RankMap< int64_t, std::size_t >;
+
+  GIVEN( "A rank map with dense IDs inserted out of order" )
+  {
+    rank_map_type rank_map;
+    std::vector< int64_t > ids = { 5, 3, 4, 1, 2, 10, 7 };
+    for ( std::size_t i = 0; i < ids.size(); ++i ) rank_map.insert( ids[ i ], i + 1 );
+
+    THEN( "It should be kept in an array" )
+    {
+      REQUIRE( rank_map.is_dense() );
+      REQUIRE( rank_map.size() == ids.size() );
+      for ( std::size_t i = 0; i < ids.size(); ++i ) REQUIRE( rank_map.get( ids[ i ] ) == i + 1 );
+      REQUIRE( rank_map.get( 6 ) == 0 );
+      REQUIRE( rank_map.get( 11 ) == 0 );
+      REQUIRE( !rank_map.insert( 3, 20 ) );
+      REQUIRE( rank_map.get( 3 ) == 2 );
+    }
+
+    WHEN( "An ID is erased" )
+    {
+      rank_map.erase( 4 );
+      rank_map.erase( 6 );
+
+      THEN( "Only that ID should be dropped" )
+      {
+        REQUIRE( rank_map.size() == ids.size() - 1 );
+        REQUIRE( !rank_map.contains( 4 ) );
+        REQUIRE( rank_map.contains( 5 ) );
+      }
+    }
+
+    WHEN( "A far ID is inserted" )
+    {
+      rank_map.insert( 1000000000, 8 );
+
+      THEN( "It should fall back to a hash map" )
+      {
+        REQUIRE( !rank_map.is_dense() );
+        REQUIRE( rank_map.size() == ids.size() + 1 );
+        for ( std::size_t i = 0; i < ids.size(); ++i ) REQUIRE( rank_map.get( ids[ i ] ) == i + 1 );
+        REQUIRE( rank_map.get( 1000000000 ) == 8 );
+        REQUIRE( rank_map.get( 6 ) == 0 );
+      }
+
+      AND_WHEN( "It is rebuilt from dense IDs" )
+      {
+        std::vector< int64_t > nodes = { 0, 12, 0, 11, 13 };
+        bool unique = rank_map.assign( nodes.begin(), nodes.end() );
+
+        THEN( "It should be kept in an array again" )
+        {
+          REQUIRE( unique );
+          REQUIRE( rank_map.is_dense() );
+          REQUIRE( rank_map.size() == 3 );
+          REQUIRE( rank_map.get( 12 ) == 2 );
+          REQUIRE( rank_map.get( 11 ) == 4 );
+          REQUIRE( rank_map.get( 13 ) == 5 );
+          REQUIRE( rank_map.get( 1 ) == 0 );
+        }
+      }
+    }
+  }
+
+  GIVEN( "A Dynamic graph with sparse node IDs" )
+  {
+    gum::SeqGraph< gum::Dynamic > graph;
+    graph.add_node( 1 );
+    graph.add_node( 1000000000 );
+    graph.add_node( 5 );
+
+    THEN( "Node ranks should be found" )
+    {
+      REQUIRE( graph.id_to_rank( 1 ) == 1 );
+      REQUIRE( graph.id_to_rank( 1000000000 ) == 2 );
+      REQUIRE( graph.id_to_rank( 5 ) == 3 );
+      REQUIRE( graph.id_to_rank( 2 ) == 0 );
+    }
+
+    WHEN( "The sparse node is removed and the graph is compacted" )
+    {
+      graph.remove_node( 1000000000 );
+      graph.compact();
+
+      THEN( "Node ranks should be renumbered" )
+      {
+        REQUIRE( graph.id_to_rank( 1 ) == 1 );
+        REQUIRE( graph.id_to_rank( 5 ) == 2 );
+        REQUIRE( !graph.has_node( 1000000000 ) );
+      }
+    }
+  }
+}
+
+SCENARIO( "Sorting nodes of a Dynamic SeqGraph lazily", "[seqgraph]" )
+{
+  using graph_type = gum::SeqGraph< gum::Dynamic >;
+  using succinct_type = typename graph_type::succinct_type;
+  using id_type = typename graph_type::id_type;
+  using rank_type = typename graph_type::rank_type;
+  using node_type = typename graph_type::node_type;
+
+  GIVEN( "Two copies of a Dynamic graph" )
+  {
+    graph_type graph;
+    graph.add_node( node_type( "A", "a" ), 4 );
+    graph.add_node( node_type( "CC", "c" ), 2 );
+    graph.add_node( node_type( "GGG", "g" ), 7 );
+    graph.add_node( node_type( "TTTT", "t" ), 1 );
+    graph.add_edge( graph.make_link( 4, 2 ) );
+    graph.add_edge( graph.make_link( 2, 7 ) );
+    graph.add_edge( graph.make_link( 7, 1 ) );
+    graph_type lazy( graph );
+    std::vector< std::size_t > perm = { 2, 0, 3, 1 };
+
+    WHEN( "One is sorted eagerly and the other lazily" )
+    {
+      graph.sort_nodes( perm );
+      lazy.sort_nodes( perm, gum::Lazy{} );
+
+      THEN( "Both should have the same ranks and node properties" )
+      {
+        REQUIRE( lazy.has_pending_order() );
+        REQUIRE( !graph.has_pending_order() );
+        for ( rank_type rank = 1; rank <= graph.get_node_count(); ++rank ) {
+          id_type id = graph.rank_to_id( rank );
+          REQUIRE( lazy.rank_to_id( rank ) == id );
+          REQUIRE( lazy.id_to_rank( id ) == rank );
+          REQUIRE( lazy.node_sequence( id ) == graph.node_sequence( id ) );
+          REQUIRE( lazy.get_node_prop( rank ).name == graph.get_node_prop( rank ).name );
+        }
+        std::vector< id_type > ids;
+        lazy.for_each_node( [&ids]( rank_type, id_type id ) { ids.push_back( id ); return true; } );
+        REQUIRE( ids == std::vector< id_type >( { 7, 4, 1, 2 } ) );
+        REQUIRE( lazy.successor_id( 4 ) == 1 );
+      }
+
+      AND_WHEN( "Both are converted to Succinct graphs" )
+      {
+        succinct_type sgraph( graph );
+        succinct_type slazy( lazy );
+
+        THEN( "They should be identical" )
+        {
+          REQUIRE( slazy.get_node_count() == sgraph.get_node_count() );
+          sgraph.for_each_node(
+              [&]( rank_type rank, id_type id ) {
+                id_type lid = slazy.rank_to_id( rank );
+                REQUIRE( slazy.coordinate_id( lid ) == sgraph.coordinate_id( id ) );
+                REQUIRE( slazy.node_sequence( lid ) == sgraph.node_sequence( id ) );
+                REQUIRE( slazy.outdegree( lid ) == sgraph.outdegree( id ) );
+                return true;
+              } );
+        }
+      }
+
+      AND_WHEN( "Nodes are added to and removed from the lazily sorted graph" )
+      {
+        lazy.add_node( node_type( "ACGT", "n" ), 9 );
+        lazy.update_node( 4, node_type( "AA", "u" ) );
+        lazy.remove_node( 2 );
+        lazy.compact();
+
+        THEN( "The order should be applied" )
+        {
+          REQUIRE( !lazy.has_pending_order() );
+          REQUIRE( std::as_const( lazy ).get_nodes() == std::vector< id_type >( { 7, 4, 1, 9 } ) );
+          REQUIRE( lazy.node_sequence( 4 ) == "AA" );
+          REQUIRE( lazy.node_sequence( 9 ) == "ACGT" );
+          REQUIRE( lazy.get_node_prop( 3 ).name == "t" );
+        }
+      }
+    }
+  }
+}
@@ -18,6 +18,8 @@
 
 #include <gum/basic_types.hpp>
 #include <type_traits>
+#include <vector>
+#include <utility>
 
 #include "test_base.hpp"
 
@@ -46,3 +48,92 @@ TEMPLATE_SCENARIO_SIG( "Determine the bitwise width of an integer", "[types]",
     }
   }
 }
+
+SCENARIO( "Small vector with inline storage", "[types]" )
+{
+  using vector_type = gum::SmallVector< uint64_t, 2 >;
+
+  GIVEN( "A small vector with two inline values" )
+  {
+    vector_type v;
+    v.push_back( 5 );
+    v.push_back( 7 );
+
+    THEN( "It should not allocate on the heap" )
+    {
+      REQUIRE( sizeof( vector_type ) == sizeof( std::vector< uint64_t > ) );
+      REQUIRE( v.is_inline() );
+      REQUIRE( v.size() == 2 );
+      REQUIRE( v[ 0 ] == 5 );
+      REQUIRE( v.back() == 7 );
+    }
+
+    WHEN( "More values than the inline capacity are added" )
+    {
+      for ( uint64_t i = 0; i < 10; ++i ) v.push_back( i );
+      vector_type copy( v );
+      vector_type moved( std::move( copy ) );
+
+      THEN( "They should be spilled to the heap keeping the order" )
+      {
+        REQUIRE( !v.is_inline() );
+        REQUIRE( v.size() == 12 );
+        REQUIRE( std::vector< uint64_t >( v.begin() + 2, v.end() ) ==
+                 std::vector< uint64_t >( { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 } ) );
+        REQUIRE( moved == v );
+        REQUIRE( copy.empty() );
+      }
+
+      AND_WHEN( "Values are erased and the vector is shrunk" )
+      {
+        while ( v.size() > 2 ) v.erase( v.begin() );
+        v.shrink_to_fit();
+
+        THEN( "Remaining values should be moved back inline" )
+        {
+          REQUIRE( v.is_inline() );
+          REQUIRE( v[ 0 ] == 8 );
+          REQUIRE( v[ 1 ] == 9 );
+        }
+      }
+
+      AND_WHEN( "It is move-assigned to a vector spilled to the heap" )
+      {
+        vector_type other;
+        for ( uint64_t i = 0; i < 20; ++i ) other.push_back( 100 + i );
+        other = std::move( v );
+
+        THEN( "The target should own the values and the source should be reusable" )
+        {
+          REQUIRE( other == moved );
+          REQUIRE( v.empty() );
+          REQUIRE( v.is_inline() );
+          v.push_back( 3 );
+          REQUIRE( v.size() == 1 );
+          REQUIRE( v[ 0 ] == 3 );
+          for ( uint64_t i = 0; i < 10; ++i ) v.push_back( i );
+          REQUIRE( v.size() == 11 );
+          REQUIRE( v.back() == 9 );
+        }
+      }
+
+      AND_WHEN( "An inline vector is move-assigned to it" )
+      {
+        vector_type other;
+        other.push_back( 1 );
+        v = std::move( other );
+
+        THEN( "The heap buffer should be released and the source should be reusable" )
+        {
+          REQUIRE( v.is_inline() );
+          REQUIRE( v.size() == 1 );
+          REQUIRE( v[ 0 ] == 1 );
+          REQUIRE( other.empty() );
+          other.push_back( 2 );
+          REQUIRE( other.size() == 1 );
+          REQUIRE( other[ 0 ] == 2 );
+        }
+      }
+    }
+  }
+}
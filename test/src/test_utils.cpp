@@ -770,6 +770,16 @@ SCENARIO( "Get and apply sorting permutation", "[utils]" )
         }
       }
 
+      AND_WHEN( "Applying the permutation to the array out of place in parallel" )
+      {
+        util::permute_parallel( perm, array );
+
+        THEN( "It should sort the array itself" )
+        {
+          REQUIRE( std::equal( array.begin(), array.end(), sorted.begin() ) );
+        }
+      }
+
       AND_WHEN( "Sorting multiple arrays by the permutation" )
       {
         std::vector< int > new_array( array.size() );
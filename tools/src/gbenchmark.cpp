@@ -32,6 +32,8 @@ config_parser( cxxopts::Options& options )
   options.positional_help( "GRAPH" );
   options.add_options()
       ( "i, interactive", "Wait for user confirmation after each step" )
+      ( "n, narrow", "Use the narrowest sufficient integer widths for the Succinct graph" )
+      ( "o, out-only", "Store only outgoing edges in the Succinct graph" )
       ( "f, format", "Input file format (gfa, vg, hg)", cxxopts::value< std::string >()->default_value( "" ) )
       ( "h, help", "Print this message and exit" )
       ;
@@ -94,6 +96,105 @@ compute_cg10_count( TGraph const& graph )
   return cgc10;
 }
 
+template< typename TGraph >
+auto
+compute_adjacency_checksum( TGraph const& graph )
+{
+  using id_type = typename TGraph::id_type;
+  using linktype_type = typename TGraph::linktype_type;
+
+  long long unsigned int checksum = 0;
+  auto add = [&]( id_type adj_id, linktype_type type ) {
+    checksum += graph.id_to_rank( adj_id ) + type;
+    return true;
+  };
+  graph.for_each_node( [&]( auto rank, auto id ) {
+    graph.for_each_edges_out( id, add );
+    graph.for_each_edges_in( id, add );
+    return true;
+  } );
+  return checksum;
+}
+
+template< typename TGraph >
+void
+run_benchmarks( TGraph const& graph, bool interactive )
+{
+  using timer_type = gum::Timer<>;
+
+  std::cout << "Integer width: " << static_cast< int >( gum::widthof< typename TGraph::value_type >::value )
+            << std::endl;
+
+  std::cout << "Computing CG content..." << std::endl;
+  auto total_chars = gum::util::total_nof_loci( graph );
+  decltype(compute_cg_count(graph)) cgc = 0;
+  {
+    auto timer = timer_type( "compute-cgc" );
+    cgc = compute_cg_count( graph );
+  }
+  std::cout << "CG Content: " << cgc / static_cast<double>(total_chars)
+            << " (" << cgc << ")" << std::endl;
+
+  if ( interactive ) {
+    std::cout << "Press the Enter key to continue." << std::endl;
+    std::cin.ignore();
+  }
+
+  std::cout << "Computing CG content of the first 10 bases..." << std::endl;
+  decltype(compute_cg_count(graph)) cgc10 = 0;
+  {
+    auto timer = timer_type( "compute-cgc-10" );
+    cgc10 = compute_cg10_count( graph );
+  }
+  std::cout << "CG10 Content: " << cgc10 / static_cast<double>(total_chars)
+            << " (" << cgc10 << ")" << std::endl;
+
+  if ( interactive ) {
+    std::cout << "Press the Enter key to continue." << std::endl;
+    std::cin.ignore();
+  }
+
+  std::cout << "Traversing adjacency lists of the Succinct graph..." << std::endl;
+  decltype(compute_adjacency_checksum(graph)) s_checksum = 0;
+  {
+    auto timer = timer_type( "traverse-succinct" );
+    s_checksum = compute_adjacency_checksum( graph );
+  }
+
+  std::cout << "Building a Compressed graph from the Succinct one..." << std::endl;
+  typename TGraph::compressed_type c_graph;
+  {
+    auto timer = timer_type( "build-compressed" );
+    c_graph = graph;
+  }
+
+  std::cout << "Traversing adjacency lists of the Compressed graph..." << std::endl;
+  decltype(compute_adjacency_checksum(c_graph)) c_checksum = 0;
+  {
+    auto timer = timer_type( "traverse-compressed" );
+    c_checksum = compute_adjacency_checksum( c_graph );
+  }
+  if ( s_checksum != c_checksum ) {
+    throw std::runtime_error( "adjacency checksums of Succinct and Compressed graphs differ" );
+  }
+
+  auto s_bytes = graph.size_in_bytes();
+  auto c_bytes = c_graph.size_in_bytes();
+  std::cout << "Succinct graph size: " << s_bytes << " bytes" << std::endl;
+  std::cout << "Compressed graph size: " << c_bytes << " bytes ("
+            << s_bytes / static_cast<double>(c_bytes) << "x smaller)" << std::endl;
+
+  if ( interactive ) {
+    std::cout << "Press the Enter key to continue." << std::endl;
+    std::cin.ignore();
+  }
+
+  std::cout << "Number of nodes: " << graph.get_node_count() << std::endl;
+  std::cout << "Number of edges: " << graph.get_edge_count() << std::endl;
+  std::cout << "Number of paths: " << graph.get_path_count() << std::endl;
+  std::cout << "Total number of characters: " << total_chars << std::endl;
+}
+
 int
 main( int argc, char* argv[] )
 {
@@ -108,6 +209,8 @@ main( int argc, char* argv[] )
     std::string graph_path = res[ "graph" ].as< std::string >();
     std::string format = res[ "format" ].as< std::string >();
     bool interactive = res[ "interactive" ].as< bool >();
+    bool narrow = res[ "narrow" ].as< bool >();
+    bool out_only = res[ "out-only" ].as< bool >();
 
     std::cout << "Graph file: " << graph_path << std::endl;
 
@@ -117,7 +220,7 @@ main( int argc, char* argv[] )
       std::cin.ignore();
     }
 
-    gum::SeqGraph< gum::Succinct > graph;
+    gum::SeqGraphVariant<> graph;
 
     {
       gum::SeqGraph< gum::Dynamic > d_graph;
@@ -149,7 +252,8 @@ main( int argc, char* argv[] )
       std::cout << "Building a Succinct graph from the Dynamic one..." << std::endl;
       {
         auto timer = timer_type( "build-succinct" );
-        graph = d_graph;
+        if ( narrow ) graph = gum::util::make_succinct_variant( d_graph, out_only );
+        else graph.emplace< 1 >( d_graph, out_only );
       }
 
       if ( interactive ) {
@@ -158,39 +262,8 @@ main( int argc, char* argv[] )
       }
     }
 
-    std::cout << "Computing CG content..." << std::endl;
-    auto total_chars = gum::util::total_nof_loci( graph );
-    decltype(compute_cg_count(graph)) cgc = 0;
-    {
-      auto timer = timer_type( "compute-cgc" );
-      cgc = compute_cg_count( graph );
-    }
-    std::cout << "CG Content: " << cgc / static_cast<double>(total_chars)
-              << " (" << cgc << ")" << std::endl;
-
-    if ( interactive ) {
-     std::cout << "Press the Enter key to continue." << std::endl;
-     std::cin.ignore();
-    }
-
-    std::cout << "Computing CG content of the first 10 bases..." << std::endl;
-    decltype(compute_cg_count(graph)) cgc10 = 0;
-    {
-      auto timer = timer_type( "compute-cgc-10" );
-      cgc10 = compute_cg10_count( graph );
-    }
-    std::cout << "CG10 Content: " << cgc10 / static_cast<double>(total_chars)
-              << " (" << cgc10 << ")" << std::endl;
-
-    if ( interactive ) {
-     std::cout << "Press the Enter key to continue." << std::endl;
-     std::cin.ignore();
-    }
+    std::visit( [interactive]( auto const& graph ) { run_benchmarks( graph, interactive ); }, graph );
 
-    std::cout << "Number of nodes: " << graph.get_node_count() << std::endl;
-    std::cout << "Number of edges: " << graph.get_edge_count() << std::endl;
-    std::cout << "Number of paths: " << graph.get_path_count() << std::endl;
-    std::cout << "Total number of characters: " << total_chars << std::endl;
 
     std::cout << "All Timers" << std::endl;
     std::cout << "----------" << std::endl;
@@ -38,6 +38,7 @@ config_parser( cxxopts::Options& options )
   options.positional_help( "GRAPH" );
   options.add_options()
       ( "f, format", "Input file format (gfa, gfa1, gfa2, vg, hg)", cxxopts::value< std::string >()->default_value( "" ) )
+      ( "o, order", "Reorder nodes before reporting (bfs, rcm, gorder)", cxxopts::value< std::string >()->default_value( "" ) )
       ( "h, help", "Print this message and exit" )
       ;
 
@@ -80,6 +81,10 @@ main( int argc, char* argv[] )
 
     std::string graph_path = res[ "graph" ].as< std::string >();
     std::string format = res[ "format" ].as< std::string >();
+    std::string order = res[ "order" ].as< std::string >();
+    if ( order != "" && order != "bfs" && order != "rcm" && order != "gorder" ) {
+      throw std::runtime_error( "unknown node order '" + order + "'" );
+    }
     graph_type graph;
 
     auto load_versioned_gfa = []( auto& graph, auto& graph_path, bool sorted, auto version ) {
@@ -113,46 +118,37 @@ main( int argc, char* argv[] )
     }
     else throw std::runtime_error( "unknown file format '" + format + "'" );
 
+    if ( order != "" ) {
+      graph_type::dynamic_type dyn_graph( graph );
+      if ( order == "bfs" ) util::reorder_nodes( dyn_graph, util::bfs_order( dyn_graph ) );
+      else if ( order == "rcm" ) util::reorder_nodes( dyn_graph, util::cuthill_mckee_order( dyn_graph ) );
+      else util::reorder_nodes( dyn_graph, util::gorder_order( dyn_graph ) );
+      graph = dyn_graph;
+    }
+
     std::string sort_status = util::ids_in_topological_order( graph ) ? "" : "not ";
     std::cout << "Input graph node IDs are " << sort_status << "in topological sort order."
               << std::endl;
 
-    std::vector< graph_type::rank_type > comp_ranks;
-    std::vector< graph_type::offset_type > comp_sizes;
-    gum::util::for_each_start_side( graph, [&]( auto rank, auto ) {
-      if ( !comp_ranks.empty() ) {
-        comp_sizes.push_back( rank - comp_ranks.back() );
-      }
-      comp_ranks.push_back( rank );
-      return true;
-    } );
-    if ( comp_ranks.empty() ) comp_ranks.push_back( 1 );
-    comp_sizes.push_back( graph.get_node_count() - comp_ranks.back() + 1 );
+    auto components = util::connected_components( graph );
 
     std::cout << "Number of nodes: " << graph.get_node_count() << std::endl;
     std::cout << "Number of edges: " << graph.get_edge_count() << std::endl;
     std::cout << "Number of paths: " << graph.get_path_count() << std::endl;
     std::cout << "Total node lengths: " << util::total_nof_loci( graph ) << std::endl;
     std::cout << "Max node length: " << util::max_node_len( graph ) << std::endl;
+    std::cout << "Average rank distance of adjacent nodes: " << util::average_edge_span( graph ) << std::endl;
 
     const auto& cgraph = graph;
-    std::cout << "Number of components: " << comp_ranks.size() << std::endl;
-    for ( auto cr = 0u; cr < comp_ranks.size(); ++cr ) {
-      auto nr = comp_ranks[ cr ];
+    std::cout << "Number of components: " << components.size() << std::endl;
+    for ( auto cr = 0u; cr < components.size(); ++cr ) {
+      auto nr = components.first_ranks[ cr ];
       auto nid = graph.rank_to_id( nr );
       auto name = cgraph.get_node_prop( nr ).name;
-      auto nof_edges = 0u;
-      auto last_rank = nr + comp_sizes[ cr ];
-      graph.for_each_node(
-          [ &graph, &nof_edges, last_rank ]( auto rank, auto id ) {
-            if ( rank >= last_rank ) return false;
-            nof_edges += graph.outdegree( id );
-            return true;
-          },
-          nr );
-
-      std::cout << "- Component " << cr + 1 << " with " << comp_sizes[ cr ]
-                << " nodes and " << nof_edges << " edges "
+
+      std::cout << "- Component " << cr + 1 << " with " << components.node_counts[ cr ]
+                << " nodes, " << components.edge_counts[ cr ] << " edges and "
+                << components.sequence_lengths[ cr ] << " bp"
                 << " starts with node\t" << name << " (id: " << nid
                 << "\trank: " << nr << ")" << std::endl;
     }